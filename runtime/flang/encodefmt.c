@@ -59,6 +59,8 @@ _f90io_encode_fmt(char *str,      /* unencoded format string */
 
   /* the following call is just to ensure __fortio_init() has been called: */
   __fortio_errinit03(0, 0, NULL, "encode format string");
+  if (__fortio_stats_on)
+    __fortio_stats_format();
   __fortio_fmtinit();
 
   /*  make basic checks for legal input and determine if this format has the
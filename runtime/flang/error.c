@@ -271,11 +271,17 @@ __fortio_errinit03(__INT_T unit, __INT_T bitv, __INT_T *iostat, char *str)
 
   /* save str for error messages  ... */
   err_str = str;
+
+  if (__fortio_stats_on)
+    __fortio_stats_begin(unit, gbl_avl, str, src_info.name, src_info.len,
+                         src_info.lineno);
 }
 extern void
 __fortio_errend03()
 /* restore the previous value of previous status of io error.*/
 {
+  if (__fortio_stats_on)
+    __fortio_stats_end(gbl_avl);
   free_gbl();
   restore_gbl();
 }
@@ -839,6 +845,7 @@ static int check_format = 1; /* format checking enabled */
 static int crlf = 0;         /* crlf does not denote end-of-line */
 static int legacy_large_rec_fmt = 0; /* are legacy large unf records used */
 static int no_minus_zero = 0; /* -0 allowed in formatted 0 */
+static int stream_direct = 0; /* large stream transfers bypass stdio */
 static int new_fp_formatter = TRUE;
 
 /** \brief  initialize Fortran I/O system.  Specifically, initialize
@@ -1020,6 +1027,9 @@ __fortio_init(void)
     if (strstr(envar_fortranopt, "no_minus_zero")) {
       no_minus_zero = 1;
     }
+    if (strstr(envar_fortranopt, "stream_direct")) {
+      stream_direct = 1;
+    }
     if (strstr(envar_fortranopt, "no_new_fp_formatter") ||
         strstr(envar_fortranopt, "old_fp_formatter")) {
       new_fp_formatter = 0;
@@ -1027,6 +1037,8 @@ __fortio_init(void)
       new_fp_formatter = 1;
     }
   }
+
+  __fortio_stats_init();
 }
 
 int
@@ -1053,6 +1065,12 @@ __fortio_no_minus_zero(void)
   return no_minus_zero;
 }
 
+int
+__fortio_stream_direct(void)
+{
+  return stream_direct;
+}
+
 int
 __fortio_new_fp_formatter(void)
 {
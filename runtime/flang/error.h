@@ -24,4 +24,5 @@ int __fortio_check_format(void);
 int __fortio_eor_crlf(void);
 
 int __fortio_no_minus_zero(void);
+int __fortio_stream_direct(void);
 
@@ -108,6 +108,7 @@ static int fr_Breadnum(char *, int, int);
 static __BIGREAL_T fr_getreal(char *, int, int, int *);
 static int fr_move_fwd(int);
 static int fr_read_record(void);
+static int fr_get_record(void);
 static int malloc_obuff(G *, size_t);
 static int realloc_obuff(G *, size_t);
 
@@ -3198,8 +3199,26 @@ fr_move_fwd(int len)
 
 /* ------------------------------------------------------------------- */
 
+/* read the next record; with i/o statistics on, reading a record of an
+ * external file is timed as a transfer of the rec_len bytes read
+ */
 static int
 fr_read_record(void)
+{
+  G *g = gbl;
+  long long t0;
+  int s;
+
+  if (!__fortio_stats_on || g->internal_file)
+    return fr_get_record();
+  t0 = __fortio_stats_xbegin();
+  s = fr_get_record();
+  __fortio_stats_xend(t0, s == 0 ? g->rec_len : 0, FALSE);
+  return s;
+}
+
+static int
+fr_get_record(void)
 {
   G *g = gbl;
   int idx = 0;
@@ -59,7 +59,22 @@ typedef unsigned int UINT; /* unsigned 32 bit native integer */
  * is defined in the makefile as BROKEN_FWRITE.
  */
 #undef FWRITE
-#define FWRITE __io_fwrite
+#define FWRITE(p, s, n, fp)                                                    \
+  (__fortio_stats_on ? __fortio_stats_fwrite(p, s, n, fp)                      \
+                     : __io_fwrite(p, s, n, fp))
+
+/*
+ * With i/o statistics enabled (iostats.c), FWRITE and the reads and seeks
+ * of the stdio streams of units are timed and counted.
+ */
+#undef __io_fread
+#define __io_fread(p, s, n, fp)                                                \
+  (__fortio_stats_on ? __fortio_stats_fread(p, s, n, fp) : fread(p, s, n, fp))
+#undef __io_fseek
+#define __io_fseek(fp, off, wh)                                                \
+  (__fortio_stats_on ? __fortio_stats_fseek(fp, off, wh) : fseek(fp, off, wh))
+#undef __io_fseekx
+#define __io_fseekx(fp, off, wh) __io_fseek(fp, off, wh)
 
 #define TRUE 1
 #define FALSE 0
@@ -266,6 +281,10 @@ typedef struct fcb {
   sbool native;       /* unformatted data is in native format */
   sbool asy_rw;       /* async read/write stmt active */
   struct asy *asyptr; /* pointer to asynch information,set by open */
+  sbool pio;          /* direct access unformatted transfers use pread and
+                       * pwrite at recpos rather than fp; set per statement
+                       * by __fortio_rwinit */
+  seekoffx_t recpos;  /* file offset of the next pio transfer */
   char *pread;        /* points to buffer of already read line
                        * this is currently used in namelist only
                        * record is read per line, we must point back
@@ -379,8 +398,23 @@ extern VOID __fortio_fmtend(void);
 #define EOR_CRLF __fortio_eor_crlf()
 #endif
 extern int __fortio_no_minus_zero(void);
+extern int __fortio_stream_direct(void);
 int __fortio_new_fp_formatter(void);
 
+/*****  iostats.c  *****/
+extern int __fortio_stats_on;
+extern void __fortio_stats_init(void);
+extern void __fortio_stats_begin(int unit, int depth, char *what, char *src,
+                                 int srclen, int lineno);
+extern void __fortio_stats_end(int depth);
+extern void __fortio_stats_format(void);
+extern void __fortio_stats_rec(long rec);
+extern long long __fortio_stats_xbegin(void);
+extern void __fortio_stats_xend(long long t0, long nbytes, int write);
+extern size_t __fortio_stats_fread(void *, size_t, size_t, FILE *);
+extern size_t __fortio_stats_fwrite(void *, size_t, size_t, FILE *);
+extern int __fortio_stats_fseek(FILE *, long, int);
+
 /*****  hpfio.c  *****/
 extern VOID __fort_status_init(__INT_T *, __INT_T *);
 void __fortio_stat_init(__INT_T *bitv, __INT_T *iostat);
@@ -408,3 +442,4 @@ extern void *__fortio_fiofcb_next(FIO_FCB *);
 
 extern bool __fio_eq_str(char *str, int len, char *pattern);
 extern VOID __fortio_swap_bytes(char *, int, long);
+extern void __fortio_swap_copy(char *, char *, int, size_t);
@@ -0,0 +1,421 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/* clang-format off */
+
+/** \file
+ * \brief I/O statistics and tracing per unit
+ *
+ * When FLANG_IO_STATS is set in the environment, every I/O statement is
+ * timed and charged to its unit: statements, records, bytes read and
+ * written, seeks, the time spent moving data to and from the file (the
+ * transfer time) and the time spent waiting for the I/O lock of an OpenMP
+ * program.  The rest of the statement time is the formatting, conversion
+ * and bookkeeping done by the runtime.  A table of the units is written to
+ * stderr at exit.
+ *
+ * Run time format strings are encoded by a statement of their own, which is
+ * charged to the pseudo unit "(formats)".
+ *
+ * When FLANG_IO_TRACE names a file, one line describing each statement is
+ * written to it as a JSON object:
+ *
+ *   {"unit":10,"stmt":"formatted write","file":"out.dat","src":"a.f90",
+ *    "line":12,"ns":2140,"xfer_ns":310,"lock_ns":0,"rbytes":0,
+ *    "wbytes":81,"records":1,"seeks":0}
+ *
+ * Statements nest (child data transfers, and I/O in functions referenced
+ * in an I/O list), so the active statements are kept on a stack that
+ * follows the depth of the error handling state of error.c; transfers are
+ * charged to the innermost statement and timed at the outermost level only.
+ */
+
+#include <limits.h>
+#include <time.h>
+#include "global.h"
+
+/** \brief set when statistics or tracing are enabled */
+int __fortio_stats_on;
+
+/* nanoseconds spent waiting in _mp_bcs_nest (flangrti/llcrit.c) */
+extern int _mp_bcs_nest_timed;
+extern long long _mp_bcs_nest_wait;
+
+#define STATS_NEST 8 /* deepest statement nesting followed */
+#define INTERNAL_UNIT -99
+#define FORMATS_UNIT INT_MIN
+
+/* fcb of a unit, or NULL for internal files and formats */
+#define STATS_FCB(unit)                                                        \
+  ((unit) == INTERNAL_UNIT || (unit) == FORMATS_UNIT                           \
+       ? NULL                                                                  \
+       : __fortio_find_unit(unit))
+
+struct io_unit {
+  int unit;
+  char *name; /* file last connected to the unit */
+  long stmts;
+  long records;
+  long rbytes;
+  long wbytes;
+  long seeks;
+  long long ns;
+  long long xfer_ns;
+  long long lock_ns;
+};
+
+static struct io_stmt {
+  int unit;
+  int depth; /* error.c state depth of the statement */
+  char *what;
+  FIO_FCB *fcb; /* unit's fcb when the statement began */
+  long nextrec;
+  char *src;
+  int srclen;
+  int lineno;
+  long rbytes;
+  long wbytes;
+  long seeks;
+  long long t0;
+  long long xfer_ns;
+  long long lock_ns;
+} stmts[STATS_NEST];
+
+static int nstmts;
+static int xfer_nest;
+static bool report;
+static FILE *trace;
+
+static struct io_unit *units;
+static int nunits;
+static int units_size;
+static struct io_unit *last_unit;
+
+static long long
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static struct io_unit *
+get_unit(int unit)
+{
+  int i;
+
+  if (last_unit && last_unit->unit == unit)
+    return last_unit;
+  for (i = 0; i < nunits; ++i) {
+    if (units[i].unit == unit)
+      return last_unit = &units[i];
+  }
+  if (nunits == units_size) {
+    units_size = units_size ? 2 * units_size : 16;
+    units = realloc(units, units_size * sizeof(struct io_unit));
+    if (units == NULL) {
+      __fortio_stats_on = 0;
+      return last_unit = NULL;
+    }
+  }
+  last_unit = &units[nunits++];
+  memset(last_unit, 0, sizeof(struct io_unit));
+  last_unit->unit = unit;
+  return last_unit;
+}
+
+/* remember the name of the file connected to the unit, without the
+ * trailing blanks of the preconnected units
+ */
+static void
+set_name(struct io_unit *u, FIO_FCB *f)
+{
+  size_t len;
+
+  if (f == NULL || f->name == NULL)
+    return;
+  len = strlen(f->name);
+  while (len > 0 && f->name[len - 1] == ' ')
+    --len;
+  if (u->name && strlen(u->name) == len && !strncmp(u->name, f->name, len))
+    return;
+  free(u->name);
+  u->name = malloc(len + 1);
+  if (u->name) {
+    memcpy(u->name, f->name, len);
+    u->name[len] = '\0';
+  }
+}
+
+/* write the first len characters of s, or all of it if len < 0 */
+static void
+trace_string(char *s, int len)
+{
+  int i;
+
+  if (s == NULL) {
+    fputs("null", trace);
+    return;
+  }
+  fputc('"', trace);
+  for (i = 0; (len < 0 || i < len) && s[i]; ++i) {
+    unsigned char c = s[i];
+    if (c == '"' || c == '\\')
+      fprintf(trace, "\\%c", c);
+    else if (c < ' ')
+      fprintf(trace, "\\u%04x", c);
+    else
+      fputc(c, trace);
+  }
+  fputc('"', trace);
+}
+
+static void
+trace_stmt(struct io_stmt *s, struct io_unit *u, long records, long long ns)
+{
+  if (s->unit == FORMATS_UNIT)
+    fputs("{\"unit\":null,\"stmt\":", trace);
+  else
+    fprintf(trace, "{\"unit\":%d,\"stmt\":", s->unit);
+  trace_string(s->what, -1);
+  fputs(",\"file\":", trace);
+  trace_string(u->name, -1);
+  fputs(",\"src\":", trace);
+  trace_string(s->src, s->srclen);
+  fprintf(trace,
+          ",\"line\":%d,\"ns\":%lld,\"xfer_ns\":%lld,\"lock_ns\":%lld,"
+          "\"rbytes\":%ld,\"wbytes\":%ld,\"records\":%ld,\"seeks\":%ld}\n",
+          s->lineno, ns, s->xfer_ns, s->lock_ns, s->rbytes, s->wbytes,
+          records, s->seeks);
+}
+
+/* finish the innermost active statement */
+static void
+pop_stmt(void)
+{
+  struct io_stmt *s = &stmts[--nstmts];
+  struct io_unit *u = get_unit(s->unit);
+  long long ns = now() - s->t0;
+  long records = 0;
+  FIO_FCB *f;
+
+  if (u == NULL)
+    return;
+  f = STATS_FCB(s->unit);
+  if (f && f == s->fcb && f->nextrec > s->nextrec)
+    records = f->nextrec - s->nextrec;
+  set_name(u, f);
+  u->stmts++;
+  u->records += records;
+  u->rbytes += s->rbytes;
+  u->wbytes += s->wbytes;
+  u->seeks += s->seeks;
+  u->ns += ns;
+  u->xfer_ns += s->xfer_ns;
+  u->lock_ns += s->lock_ns;
+  if (trace)
+    trace_stmt(s, u, records, ns);
+}
+
+static int
+cmp_unit(const void *a, const void *b)
+{
+  const struct io_unit *x = a, *y = b;
+
+  return x->ns < y->ns ? 1 : x->ns > y->ns ? -1 : 0;
+}
+
+static void
+print_row(FILE *f, struct io_unit *u, char *name)
+{
+  fprintf(f, " %10ld %10ld %14ld %14ld %8ld %10.3f %10.3f %10.3f %10.3f  %s\n",
+          u->stmts, u->records, u->rbytes, u->wbytes, u->seeks, u->ns / 1e6,
+          u->xfer_ns / 1e6, (u->ns - u->xfer_ns) / 1e6, u->lock_ns / 1e6,
+          name);
+}
+
+static void
+report_io_stats(void)
+{
+  FILE *f = __io_stderr();
+  struct io_unit t;
+  int i;
+
+  while (nstmts > 0)
+    pop_stmt();
+  if (trace)
+    fflush(trace);
+  if (!report)
+    return;
+  qsort(units, nunits, sizeof(struct io_unit), cmp_unit);
+  last_unit = NULL;
+  memset(&t, 0, sizeof(t));
+  fprintf(f, "FLANG_IO_STATS: i/o by unit, times in milliseconds\n");
+  fprintf(f, "%6s %10s %10s %14s %14s %8s %10s %10s %10s %10s  %s\n",
+          "unit", "stmts", "records", "bytes read", "bytes written", "seeks",
+          "total", "transfer", "convert", "lock wait", "file");
+  for (i = 0; i < nunits; ++i) {
+    struct io_unit *u = &units[i];
+    if (u->stmts == 0)
+      continue;
+    if (u->unit == FORMATS_UNIT) {
+      fprintf(f, "%6s", "");
+      print_row(f, u, "(formats)");
+    } else {
+      fprintf(f, "%6d", u->unit);
+      print_row(f, u, u->unit == INTERNAL_UNIT ? "(internal)"
+                                               : u->name ? u->name : "");
+    }
+    t.stmts += u->stmts;
+    t.records += u->records;
+    t.rbytes += u->rbytes;
+    t.wbytes += u->wbytes;
+    t.seeks += u->seeks;
+    t.ns += u->ns;
+    t.xfer_ns += u->xfer_ns;
+    t.lock_ns += u->lock_ns;
+  }
+  fprintf(f, "%6s", "");
+  print_row(f, &t, "total");
+}
+
+/** \brief Check the environment; called once when the I/O system starts */
+void
+__fortio_stats_init(void)
+{
+  char *p;
+
+  report = __fort_getenv("FLANG_IO_STATS") != NULL;
+  p = __fort_getenv("FLANG_IO_TRACE");
+  if (p && *p) {
+    trace = fopen(p, "w");
+    if (trace == NULL)
+      fprintf(__io_stderr(), "FLANG_IO_TRACE: cannot open %s\n", p);
+  }
+  if (report || trace) {
+    __fortio_stats_on = 1;
+    _mp_bcs_nest_timed = 1;
+    atexit(report_io_stats);
+  }
+}
+
+/** \brief An I/O statement on unit begins; depth is its error state depth */
+void
+__fortio_stats_begin(int unit, int depth, char *what, char *src, int srclen,
+                     int lineno)
+{
+  struct io_stmt *s;
+
+  /* finish any statement left active at this depth by an error */
+  while (nstmts > 0 && stmts[nstmts - 1].depth >= depth)
+    pop_stmt();
+  if (nstmts == STATS_NEST)
+    return;
+  s = &stmts[nstmts++];
+  memset(s, 0, sizeof(*s));
+  s->unit = unit;
+  s->depth = depth;
+  s->what = what;
+  s->src = src;
+  s->srclen = srclen;
+  s->lineno = lineno;
+  s->fcb = STATS_FCB(unit);
+  s->nextrec = s->fcb ? s->fcb->nextrec : 0;
+  if (s->fcb && get_unit(unit))
+    set_name(last_unit, s->fcb); /* the fcb is gone after a CLOSE */
+  s->lock_ns = _mp_bcs_nest_wait;
+  _mp_bcs_nest_wait = 0;
+  s->t0 = now();
+}
+
+/** \brief The I/O statement at depth ends */
+void
+__fortio_stats_end(int depth)
+{
+  if (nstmts > 0 && stmts[nstmts - 1].depth == depth)
+    pop_stmt();
+}
+
+/** \brief The statement that began is the encoding of a format */
+void
+__fortio_stats_format(void)
+{
+  struct io_stmt *s;
+
+  if (nstmts == 0)
+    return;
+  s = &stmts[nstmts - 1];
+  s->unit = FORMATS_UNIT;
+  s->fcb = NULL;
+  /* leave the lock wait to the data transfer statement that follows */
+  _mp_bcs_nest_wait += s->lock_ns;
+  s->lock_ns = 0;
+}
+
+/** \brief The direct access statement that began transfers record rec */
+void
+__fortio_stats_rec(long rec)
+{
+  if (nstmts > 0)
+    stmts[nstmts - 1].nextrec = rec;
+}
+
+/** \brief Start a transfer; returns its start time at the outermost level */
+long long
+__fortio_stats_xbegin(void)
+{
+  return xfer_nest++ == 0 ? now() : 0;
+}
+
+/** \brief End the transfer started at t0, which moved nbytes */
+void
+__fortio_stats_xend(long long t0, long nbytes, int write)
+{
+  struct io_stmt *s;
+
+  if (--xfer_nest != 0 || nstmts == 0)
+    return;
+  s = &stmts[nstmts - 1];
+  s->xfer_ns += now() - t0;
+  if (write)
+    s->wbytes += nbytes;
+  else
+    s->rbytes += nbytes;
+}
+
+size_t
+__fortio_stats_fread(void *ptr, size_t size, size_t nitems, FILE *fp)
+{
+  long long t0 = __fortio_stats_xbegin();
+  size_t n = fread(ptr, size, nitems, fp);
+
+  __fortio_stats_xend(t0, size * n, FALSE);
+  return n;
+}
+
+size_t
+__fortio_stats_fwrite(void *ptr, size_t size, size_t nitems, FILE *fp)
+{
+  long long t0 = __fortio_stats_xbegin();
+  size_t n = __io_fwrite(ptr, size, nitems, fp);
+
+  __fortio_stats_xend(t0, size * n, TRUE);
+  return n;
+}
+
+int
+__fortio_stats_fseek(FILE *fp, long off, int whence)
+{
+  long long t0 = __fortio_stats_xbegin();
+  int s = fseek(fp, off, whence);
+
+  if (nstmts > 0)
+    stmts[nstmts - 1].seeks++;
+  __fortio_stats_xend(t0, 0, FALSE);
+  return s;
+}
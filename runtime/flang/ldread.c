@@ -30,6 +30,7 @@ static int dbgflag;
 
 int read_record_internal(void);
 static int read_record(void);
+static int get_record(void);
 static char *alloc_rbuf(int, bool);
 static int skip_record(void);
 
@@ -1543,8 +1544,23 @@ find_char(int ch)
 /*    read  support   */
 /* ********************/
 
+/* read the next record, timed as a transfer when counting i/o statistics */
 static int
 read_record(void)
+{
+  long long t0;
+  int s;
+
+  if (!__fortio_stats_on || internal_file)
+    return get_record();
+  t0 = __fortio_stats_xbegin();
+  s = get_record();
+  __fortio_stats_xend(t0, s == 0 ? byte_cnt : 0, FALSE);
+  return s;
+}
+
+static int
+get_record(void)
 {
   if (internal_file) {
     if (n_irecs == 0)
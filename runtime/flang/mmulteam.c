@@ -0,0 +1,156 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/* clang-format off */
+
+/** \file
+ * \brief F90 MATMUL intrinsic split across the current OpenMP team
+ *
+ * Called by every thread of a team for a MATMUL inside !$OMP WORKSHARE.
+ * Each thread multiplies its own block of the result through the serial
+ * MATMUL entry for the element type; the caller supplies the barrier.
+ */
+
+#include "stdioInterf.h"
+#include "fioMacros.h"
+
+extern int omp_get_thread_num(void);
+extern int omp_get_num_threads(void);
+
+#define MMUL_ARGS                                                              \
+  char *, char *, char *, F90_Desc *, F90_Desc *, F90_Desc *
+
+void ENTF90(MATMUL_INT1, matmul_int1)(MMUL_ARGS);
+void ENTF90(MATMUL_INT2, matmul_int2)(MMUL_ARGS);
+void ENTF90(MATMUL_INT4, matmul_int4)(MMUL_ARGS);
+void ENTF90(MATMUL_INT8, matmul_int8)(MMUL_ARGS);
+void ENTF90(MATMUL_LOG1, matmul_log1)(MMUL_ARGS);
+void ENTF90(MATMUL_LOG2, matmul_log2)(MMUL_ARGS);
+void ENTF90(MATMUL_LOG4, matmul_log4)(MMUL_ARGS);
+void ENTF90(MATMUL_LOG8, matmul_log8)(MMUL_ARGS);
+void ENTF90(MATMUL_REAL4, matmul_real4)(MMUL_ARGS);
+void ENTF90(MATMUL_REAL8, matmul_real8)(MMUL_ARGS);
+void ENTF90(MATMUL_REAL16, matmul_real16)(MMUL_ARGS);
+void ENTF90(MATMUL_CPLX8, matmul_cplx8)(MMUL_ARGS);
+void ENTF90(MATMUL_CPLX16, matmul_cplx16)(MMUL_ARGS);
+void ENTF90(MATMUL_CPLX32, matmul_cplx32)(MMUL_ARGS);
+
+typedef void (*mmul_fn)(MMUL_ARGS);
+
+static mmul_fn
+mmul_kernel(dtype kind)
+{
+  switch (kind) {
+  case __INT1:
+    return ENTF90(MATMUL_INT1, matmul_int1);
+  case __INT2:
+    return ENTF90(MATMUL_INT2, matmul_int2);
+  case __INT4:
+    return ENTF90(MATMUL_INT4, matmul_int4);
+  case __INT8:
+    return ENTF90(MATMUL_INT8, matmul_int8);
+  case __LOG1:
+    return ENTF90(MATMUL_LOG1, matmul_log1);
+  case __LOG2:
+    return ENTF90(MATMUL_LOG2, matmul_log2);
+  case __LOG4:
+    return ENTF90(MATMUL_LOG4, matmul_log4);
+  case __LOG8:
+    return ENTF90(MATMUL_LOG8, matmul_log8);
+  case __REAL4:
+    return ENTF90(MATMUL_REAL4, matmul_real4);
+  case __REAL8:
+    return ENTF90(MATMUL_REAL8, matmul_real8);
+  case __REAL16:
+    return ENTF90(MATMUL_REAL16, matmul_real16);
+  case __CPLX8:
+    return ENTF90(MATMUL_CPLX8, matmul_cplx8);
+  case __CPLX16:
+    return ENTF90(MATMUL_CPLX16, matmul_cplx16);
+  case __CPLX32:
+    return ENTF90(MATMUL_CPLX32, matmul_cplx32);
+  default:
+    __fort_abort("MATMUL: unsupported result type");
+  }
+  return NULL;
+}
+
+/* Section d of a covering the whole array except dimension dim (1-based),
+ * which is narrowed to its elements lo..hi (0-based). */
+static void
+I8(team_section)(F90_Desc *d, F90_Desc *a, int dim, __INT_T lo, __INT_T hi)
+{
+  DECL_DIM_PTRS(ad);
+  __INT_T i, lb;
+
+  __DIST_INIT_SECTION(d, F90_RANK_G(a), a);
+  for (i = 1; i <= F90_RANK_G(a); ++i) {
+    SET_DIM_PTRS(ad, a, i - 1);
+    lb = F90_DPTR_LBOUND_G(ad);
+    if (i == dim)
+      I8(__fort_set_section)(d, i, a, i, lb + lo, lb + hi, 1);
+    else
+      I8(__fort_set_section)(d, i, a, i, lb, DPTR_UBOUND_G(ad), 1);
+  }
+  I8(__fort_finish_section)(d);
+}
+
+void ENTF90(MATMUL_TEAM, matmul_team)(char *dest_addr, char *s1_addr,
+                                      char *s2_addr, F90_Desc *dest_desc,
+                                      F90_Desc *s1_desc, F90_Desc *s2_desc)
+{
+  DECL_HDR_VARS(dc);
+  DECL_HDR_VARS(s1c);
+  DECL_HDR_VARS(s2c);
+  mmul_fn fn;
+  __INT_T extent, split, chunk, rem, lo, hi;
+  int nthreads, tid;
+
+  fn = mmul_kernel(F90_KIND_G(dest_desc));
+  nthreads = omp_get_num_threads();
+  if (nthreads <= 1) {
+    fn(dest_addr, s1_addr, s2_addr, dest_desc, s1_desc, s2_desc);
+    return;
+  }
+
+  /* Block the dimension of the result that maps onto a single source
+   * operand:
+   *   mxm  s1(n,m) x s2(m,k) -> dest(n,k)   split k: dest dim 2, s2 dim 2
+   *   mxv  s1(n,m) x s2(m)   -> dest(n)     split n: dest dim 1, s1 dim 1
+   *   vxm  s1(m)   x s2(m,k) -> dest(k)     split k: dest dim 1, s2 dim 2
+   * Shape errors are left to the serial entry on the whole arrays.
+   */
+  if (F90_RANK_G(s2_desc) == 1) {
+    split = F90_RANK_G(s1_desc) == 2 ? F90_DIM_EXTENT_G(s1_desc, 0) : -1;
+  } else {
+    split = F90_DIM_EXTENT_G(s2_desc, 1);
+  }
+  extent = F90_DIM_EXTENT_G(dest_desc, F90_RANK_G(dest_desc) - 1);
+  if (extent != split) {
+    if (omp_get_thread_num() == 0)
+      fn(dest_addr, s1_addr, s2_addr, dest_desc, s1_desc, s2_desc);
+    return;
+  }
+
+  tid = omp_get_thread_num();
+  if (tid >= extent)
+    return;
+  chunk = extent / nthreads;
+  rem = extent % nthreads;
+  lo = tid * chunk + (tid < rem ? tid : rem);
+  hi = lo + chunk - (tid < rem ? 0 : 1);
+
+  if (F90_RANK_G(s2_desc) == 1) {
+    I8(team_section)(dc, dest_desc, 1, lo, hi);
+    I8(team_section)(s1c, s1_desc, 1, lo, hi);
+    fn(dest_addr, s1_addr, s2_addr, dc, s1c, s2_desc);
+  } else {
+    I8(team_section)(dc, dest_desc, F90_RANK_G(dest_desc), lo, hi);
+    I8(team_section)(s2c, s2_desc, 2, lo, hi);
+    fn(dest_addr, s1_addr, s2_addr, dc, s1_desc, s2c);
+  }
+}
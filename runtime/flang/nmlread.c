@@ -144,10 +144,39 @@ static G *gbl_head = &static_gbl[0];
 static int gbl_avl = 0;
 static int gbl_size = GBL_SIZE;
 
+/* A hashed index of the names of the items of a namelist group and of
+ * the members of its derived type items, built the first time the group is
+ * read.  A slot maps a name and the offset of the derived type item or
+ * member it belongs to (0 for the items of the group) to the offset of its
+ * descriptor; offsets are from the group descriptor.
+ */
+typedef struct {
+  long parent; /* offset of the parent descriptor, 0 for a group item */
+  long off;    /* offset of the descriptor, 0 if the slot is empty */
+} NML_SLOT;
+
+typedef struct nml_index {
+  struct nml_index *next;
+  NML_GROUP *grp;   /* the group; its name and item count are kept too */
+  char *group;      /* so that a reused address is not taken for it */
+  __POINT_T ndesc;
+  int mask;         /* number of slots - 1 */
+  NML_SLOT *slots;
+} NML_INDEX;
+
+#define NML_INDEX_MIN 8  /* fewer names than this are just scanned */
+#define NML_INDEX_MAX 64 /* indexes kept, most recently read first */
+
+static NML_INDEX *nml_indexes;
+static NML_INDEX *cur_index; /* index of the group being read, or NULL */
+
 static void shared_init(void);
 static NML_DESC *skip_to_next(NML_DESC *);
 static NML_DESC *skip_dtio_datainit(NML_DESC *);
+static NML_DESC *first_member(NML_DESC *);
 static int find_group(char *, int);
+static NML_INDEX *get_index(NML_GROUP *);
+static NML_DESC *index_lookup(NML_DESC *);
 static int get_token(void);
 static int do_parse(NML_GROUP *);
 static int parse_ref(NML_DESC *);
@@ -175,6 +204,7 @@ static int dtio_assign(NML_DESC *, char *, char **, bool, bool);
 #define NML_ERROR(e) (__fortio_error(e))
 
 static int read_record(void);
+static int get_record(void);
 static char *alloc_rbuf(int, bool);
 static SB sb;
 
@@ -429,6 +459,7 @@ static int
 _f90io_nml_read(NML_GROUP *nmldesc) 
 {
   int err;
+  NML_INDEX *save_index;
 
   /* first check for errors: */
   if (fioFcbTbls.eof)
@@ -442,6 +473,9 @@ _f90io_nml_read(NML_GROUP *nmldesc)
   if (err != 0)
     return err; /*  error or eof condition  */
 
+  save_index = cur_index;
+  cur_index = get_index(nmldesc);
+
   /* -------- file is now positioned immediately after group name:  */
 
   live_token = 0;
@@ -467,6 +501,7 @@ _f90io_nml_read(NML_GROUP *nmldesc)
   }
   err = 0;
 return_err:
+  cur_index = save_index;
   free(vrf.base);
   free(tri.base);
   return err;
@@ -1131,23 +1166,26 @@ do_parse(NML_GROUP *nmldesc)
 
   /* find the matching namelist item descriptors */
 
-  /*  point to the first item descriptor:  */
-  descp = (NML_DESC *)((char *)nmldesc + sizeof(NML_GROUP));
+  descp = index_lookup(NULL);
+  if (descp == NULL) {
+    /*  point to the first item descriptor:  */
+    descp = (NML_DESC *)((char *)nmldesc + sizeof(NML_GROUP));
 
-  i = 0;
-  while (TRUE) {
-    if (strlen(token_buff) == descp->nlen &&
-        strncmp(descp->sym, token_buff, (int)descp->nlen) == 0)
-      break;
+    i = 0;
+    while (TRUE) {
+      if (strlen(token_buff) == descp->nlen &&
+          strncmp(descp->sym, token_buff, (int)descp->nlen) == 0)
+        break;
 
-    i++;
-    if (i >= nmldesc->ndesc)
-      break;
+      i++;
+      if (i >= nmldesc->ndesc)
+        break;
 
-    descp = skip_to_next(descp);
+      descp = skip_to_next(descp);
+    }
+    if (i == nmldesc->ndesc) /* match not found */
+      return NML_ERROR(FIO_ENOTMEM);
   }
-  if (i == nmldesc->ndesc) /* match not found */
-    return NML_ERROR(FIO_ENOTMEM);
 
   /* Setup for the main parsing loop: */
   vrf.avl = 0;
@@ -1198,10 +1236,188 @@ skip_dtio_datainit(NML_DESC *descp)
   return next_descp;
 }
 
+/** \brief Return the descriptor of the first member of derived type item
+ * descp.
+ */
+static NML_DESC *
+first_member(NML_DESC *descp)
+{
+  __POINT_T actual_ndims;
+  int k;
+
+  /*  compute number of bytes to add to reach next descriptor: */
+  ACTUAL_NDIMS(actual_ndims);
+  if (descp->ndims >= MAX_DIM) {
+    /* need to skip dtio data init section */
+    return skip_dtio_datainit(descp);
+  }
+  if (actual_ndims >= 0)
+    k = sizeof(NML_DESC) + (actual_ndims * sizeof(__POINT_T) * 2);
+  else
+    k = sizeof(NML_DESC) + (sizeof(__POINT_T) * 2);
+  return (NML_DESC *)((char *)descp + k);
+}
+
+static unsigned
+index_hash(long parent, char *name, int nlen)
+{
+  unsigned h = 2166136261u ^ (unsigned)parent;
+  int i;
+
+  for (i = 0; i < nlen; ++i)
+    h = (h ^ (unsigned char)name[i]) * 16777619u;
+  return h;
+}
+
+/* Add descp, a member of parent or an item of the group if parent is NULL,
+ * to index ix.  Like the scans, the first of two equal names is found.
+ */
+static void
+index_add(NML_INDEX *ix, NML_DESC *parent, NML_DESC *descp)
+{
+  long poff = parent ? (char *)parent - (char *)ix->grp : 0;
+  unsigned h = index_hash(poff, descp->sym, descp->nlen);
+  NML_SLOT *slot;
+  NML_DESC *d;
+
+  while ((slot = &ix->slots[h & ix->mask])->off) {
+    d = (NML_DESC *)((char *)ix->grp + slot->off);
+    if (slot->parent == poff && d->nlen == descp->nlen &&
+        strncmp(d->sym, descp->sym, descp->nlen) == 0)
+      return;
+    ++h;
+  }
+  slot->parent = poff;
+  slot->off = (char *)descp - (char *)ix->grp;
+}
+
+/* Count the members of derived type item descp and of the derived type
+ * members they contain, adding them to ix if it is not NULL.  Items with
+ * defined i/o are left out and their members are found by a scan.
+ */
+static int
+index_members(NML_INDEX *ix, NML_DESC *descp)
+{
+  NML_DESC *mp;
+  int n = 0;
+
+  if (descp->type != __DERIVED || descp->ndims == -2 ||
+      descp->ndims >= MAX_DIM)
+    return 0;
+  for (mp = first_member(descp); mp->nlen; mp = skip_to_next(mp)) {
+    if (ix)
+      index_add(ix, descp, mp);
+    n += 1 + index_members(ix, mp);
+  }
+  return n;
+}
+
+/* Count the items of group grp and their members, adding them to ix if it
+ * is not NULL.
+ */
+static int
+index_group(NML_INDEX *ix, NML_GROUP *grp)
+{
+  NML_DESC *descp;
+  int i, n;
+
+  descp = (NML_DESC *)((char *)grp + sizeof(NML_GROUP));
+  n = 0;
+  for (i = 0; i < grp->ndesc; ++i) {
+    if (ix)
+      index_add(ix, NULL, descp);
+    n += 1 + index_members(ix, descp);
+    if (i + 1 < grp->ndesc)
+      descp = skip_to_next(descp);
+  }
+  return n;
+}
+
+/** \brief Return the name index of group grp, building it if this is the
+ * first read of the group.  Return NULL if the group is too small to be
+ * worth an index or if there is no memory for it.
+ */
+static NML_INDEX *
+get_index(NML_GROUP *grp)
+{
+  NML_INDEX *ix, **prev;
+  int n, cnt, size;
+
+  cnt = 0;
+  for (prev = &nml_indexes; (ix = *prev) != NULL; prev = &ix->next) {
+    if (ix->grp == grp && ix->group == grp->group && ix->ndesc == grp->ndesc) {
+      /* move it to the front */
+      *prev = ix->next;
+      ix->next = nml_indexes;
+      nml_indexes = ix;
+      return ix;
+    }
+    if (++cnt == NML_INDEX_MAX && ix->next) {
+      /* forget the least recently read group */
+      free(ix->next->slots);
+      free(ix->next);
+      ix->next = NULL;
+      break;
+    }
+  }
+
+  n = index_group(NULL, grp);
+  if (n < NML_INDEX_MIN)
+    return NULL;
+  for (size = 16; size < 2 * n; size *= 2)
+    ;
+  ix = (NML_INDEX *)malloc(sizeof(NML_INDEX));
+  if (ix == NULL)
+    return NULL;
+  ix->slots = (NML_SLOT *)calloc(size, sizeof(NML_SLOT));
+  if (ix->slots == NULL) {
+    free(ix);
+    return NULL;
+  }
+  ix->grp = grp;
+  ix->group = grp->group;
+  ix->ndesc = grp->ndesc;
+  ix->mask = size - 1;
+  (void)index_group(ix, grp);
+  ix->next = nml_indexes;
+  nml_indexes = ix;
+  return ix;
+}
+
+/** \brief Look token_buff up in the index of the group being read, as a
+ * member of derived type item parent, or as an item of the group if parent
+ * is NULL.  Return NULL if there is no index or the name is not found;
+ * the caller then scans the descriptors.
+ */
+static NML_DESC *
+index_lookup(NML_DESC *parent)
+{
+  NML_INDEX *ix = cur_index;
+  NML_SLOT *slot;
+  NML_DESC *d;
+  long poff;
+  int nlen;
+  unsigned h;
+
+  if (ix == NULL)
+    return NULL;
+  poff = parent ? (char *)parent - (char *)ix->grp : 0;
+  nlen = strlen(token_buff);
+  h = index_hash(poff, token_buff, nlen);
+  while ((slot = &ix->slots[h & ix->mask])->off) {
+    d = (NML_DESC *)((char *)ix->grp + slot->off);
+    if (slot->parent == poff && d->nlen == nlen &&
+        strncmp(d->sym, token_buff, nlen) == 0)
+      return d;
+    ++h;
+  }
+  return NULL;
+}
+
 static int
 parse_ref(NML_DESC *gdescp)
 {
-  int i, k;
+  int i;
   NML_DESC *descp, *next_descp;
   __POINT_T new_ndims;
   __POINT_T actual_ndims;
@@ -1224,25 +1440,19 @@ ref_loop:
     if (descp->type != __DERIVED)
       return NML_ERROR(FIO_ESYNTAX);
 
-    /* -- scan item descriptors to find one with name that matches:  */
-    /*  compute number of bytes to add to reach next descriptor: */
-    if (actual_ndims >= 0)
-      k = sizeof(NML_DESC) + (actual_ndims * sizeof(__POINT_T) * 2);
-    else
-      k = sizeof(NML_DESC) + (sizeof(__POINT_T) * 2);
-    next_descp = (NML_DESC *)((char *)descp + k);
-    if (descp->ndims >= 30) {
-      /* need to skip dtio data init section */
-      next_descp = skip_dtio_datainit(descp);
-    }
-    while (TRUE) {
-      if (next_descp->nlen == 0) {
-        return NML_ERROR(FIO_ESYNTAX);
+    next_descp = index_lookup(descp);
+    if (next_descp == NULL) {
+      /* -- scan item descriptors to find one with name that matches:  */
+      next_descp = first_member(descp);
+      while (TRUE) {
+        if (next_descp->nlen == 0) {
+          return NML_ERROR(FIO_ESYNTAX);
+        }
+        if (strlen(token_buff) == next_descp->nlen &&
+            strncmp(next_descp->sym, token_buff, next_descp->nlen) == 0)
+          break;
+        next_descp = skip_to_next(next_descp);
       }
-      if (strlen(token_buff) == next_descp->nlen &&
-          strncmp(next_descp->sym, token_buff, next_descp->nlen) == 0)
-        break;
-      next_descp = skip_to_next(next_descp);
     }
     descp = next_descp;
     vrf_cur = add_vrf(VRF_MEMBER, descp);
@@ -2163,8 +2373,25 @@ ENTCRF90IO(NMLR_END, nmlr_end)()
 /*    read  support   */
 /* ********************/
 
+/* read the next line of a namelist group, timed as a transfer when
+ * counting i/o statistics
+ */
 static int
 read_record(void)
+{
+  long long t0;
+  int s;
+
+  if (!__fortio_stats_on || internal_file)
+    return get_record();
+  t0 = __fortio_stats_xbegin();
+  s = get_record();
+  __fortio_stats_xend(t0, s == 0 ? byte_cnt : 0, FALSE);
+  return s;
+}
+
+static int
+get_record(void)
 {
   if (internal_file) {
     if (n_irecs == 0) {
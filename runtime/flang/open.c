@@ -353,6 +353,7 @@ __fortio_open(int unit, int action_flag, int status_flag, int dispose_flag,
   f->binary = FALSE;
   f->asy_rw = 0; /* init async flags */
   f->asyptr = (void *)0;
+  f->pio = FALSE;
   f->decimal = FIO_POINT;
   f->encoding = FIO_DEFAULT;
   f->round = FIO_COMPATIBLE;
@@ -27,6 +27,11 @@ ENTFTN(TEMPLATE, template)(F90_Desc *dd, __INT_T *p_rank,
 #include <sys/wait.h>
 #endif
 static void store_int_kind(void *, __INT_T *, int);
+void __fort_copy_stat(void *, long, long);
+
+/* count a copy made for the caller of the enclosing routine */
+#define COPY_STAT(in, out)                                                     \
+  __fort_copy_stat(__builtin_return_address(0), (long)(in), (long)(out))
 static void ftn_msgcpy(char*, const char*, int);
 static char *intents[] = {"INOUT", "IN", "OUT", "??"};
 
@@ -1735,6 +1740,111 @@ ENTF90(ADDR_1_DIM_1ST_ELEM, addr_1_dim_1st_elem)
   *addr = ab ? ad : ab;
 }
 
+#ifndef DESC_I8
+
+/* Copy-in/copy-out statistics per call site, collected when
+ * FLANG_COPY_STATS is set in the environment and written to stderr at
+ * exit.  A call site is the return address of the copy routine, or of
+ * f90_copy_stat for copies generated inline; addr2line maps it to a line.
+ */
+#define COPY_STAT_SITES 1021
+
+static struct copy_stat {
+  void *site;
+  long copies;
+  long bytes_in;
+  long bytes_out;
+} copy_stats[COPY_STAT_SITES + 1]; /* last entry collects the overflow */
+
+static int copy_stats_state; /* 0 = not yet checked, 1 = off, 2 = on */
+
+static int
+cmp_copy_stat(const void *a, const void *b)
+{
+  const struct copy_stat *x = a, *y = b;
+  long bx = x->bytes_in + x->bytes_out;
+  long by = y->bytes_in + y->bytes_out;
+
+  return bx < by ? 1 : bx > by ? -1 : 0;
+}
+
+static void
+report_copy_stats(void)
+{
+  static struct copy_stat sorted[COPY_STAT_SITES + 1];
+  FILE *f = __io_stderr();
+  long copies = 0, bytes_in = 0, bytes_out = 0;
+  int i, n;
+
+  for (i = n = 0; i <= COPY_STAT_SITES; ++i) {
+    if (copy_stats[i].copies)
+      sorted[n++] = copy_stats[i];
+  }
+  qsort(sorted, n, sizeof(sorted[0]), cmp_copy_stat);
+  fprintf(f, "FLANG_COPY_STATS: argument copies by call site\n");
+  fprintf(f, "%18s %12s %16s %16s\n", "site", "copies", "bytes in",
+          "bytes out");
+  for (i = 0; i < n; ++i) {
+    if (sorted[i].site)
+      fprintf(f, "%18p", sorted[i].site);
+    else
+      fprintf(f, "%18s", "(other)");
+    fprintf(f, " %12ld %16ld %16ld\n", sorted[i].copies, sorted[i].bytes_in,
+            sorted[i].bytes_out);
+    copies += sorted[i].copies;
+    bytes_in += sorted[i].bytes_in;
+    bytes_out += sorted[i].bytes_out;
+  }
+  fprintf(f, "%18s %12ld %16ld %16ld\n", "total", copies, bytes_in,
+          bytes_out);
+}
+
+/** \brief Count one argument copy at call site `site' */
+void
+__fort_copy_stat(void *site, long bytes_in, long bytes_out)
+{
+  struct copy_stat *cs;
+  unsigned long h;
+  int i;
+
+  if (copy_stats_state != 2) {
+    if (copy_stats_state == 1)
+      return;
+    if (getenv("FLANG_COPY_STATS") == NULL) {
+      copy_stats_state = 1;
+      return;
+    }
+    if (__sync_bool_compare_and_swap(&copy_stats_state, 0, 2))
+      atexit(report_copy_stats);
+  }
+
+  h = ((unsigned long)site >> 2) % COPY_STAT_SITES;
+  cs = &copy_stats[COPY_STAT_SITES];
+  for (i = 0; i < COPY_STAT_SITES; ++i) {
+    struct copy_stat *p = &copy_stats[(h + i) % COPY_STAT_SITES];
+    if (p->site == site ||
+        (p->site == NULL &&
+         __sync_bool_compare_and_swap(&p->site, NULL, site)) ||
+        p->site == site) {
+      cs = p;
+      break;
+    }
+  }
+  __sync_fetch_and_add(&cs->copies, 1);
+  __sync_fetch_and_add(&cs->bytes_in, bytes_in);
+  __sync_fetch_and_add(&cs->bytes_out, bytes_out);
+}
+
+/** \brief Count an argument copy the compiler generated inline */
+void
+ENTF90(COPY_STAT, copy_stat)(__INT8_T *bytes_in, __INT8_T *bytes_out)
+{
+  if (copy_stats_state != 1)
+    __fort_copy_stat(__builtin_return_address(0), *bytes_in, *bytes_out);
+}
+
+#endif
+
 /* no longer needed after 5.2 */
 void
 ENTF90(COPY_F77_ARG, copy_f77_arg)(char **ab, F90_Desc *ad, char **db_ptr,
@@ -1934,10 +2044,12 @@ ENTF90(COPY_F77_ARGL, copy_f77_argl)(char **ab, F90_Desc *ad, char *afirst,
 
       I8(local_copy)(*db_ptr, cd, F90_LBASE_G(cd)-1, *ab, ad, 
                        F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_IN);
+      COPY_STAT(nbr_elem * F90_LEN_G(cd), 0);
     } else {
       if (*copy_in == 0) {
         I8(local_copy)(*db_ptr, cd, F90_LBASE_G(cd)-1, *ab, ad, 
                            F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_OUT);
+        COPY_STAT(0, nbr_elem * F90_LEN_G(cd));
       }
       I8(__fort_dealloc)(*db_ptr, 0, __fort_gfree);
     }
@@ -2009,10 +2121,12 @@ ENTF90(COPY_F77_ARGSL, copy_f77_argsl)
 
       I8(local_copy)(*db_ptr, cd, F90_LBASE_G(cd)-1, ab, ad, 
                        F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_IN);
+      COPY_STAT(nbr_elem * F90_LEN_G(cd), 0);
     } else {
       if (*copy_in == 0) {
         I8(local_copy)(*db_ptr, cd, F90_LBASE_G(cd)-1, ab, ad, 
                            F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_OUT);
+        COPY_STAT(0, nbr_elem * F90_LEN_G(cd));
       }
       I8(__fort_dealloc)(*db_ptr, 0, __fort_gfree);
     }
@@ -2121,6 +2235,7 @@ ENTF90(COPY_F90_ARG, copy_f90_arg)
 
       I8(local_copy)(*db, dd, F90_LBASE_G(dd)-1, *ab, ad, 
                             F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_IN);
+      COPY_STAT(nbr_elem * F90_LEN_G(dd), 0);
     }
   } else {
     if (F90_DIM_SSTRIDE_G(ad, 0) == 1 && F90_DIM_LSTRIDE_G(ad, 0) == 1) {
@@ -2129,6 +2244,7 @@ ENTF90(COPY_F90_ARG, copy_f90_arg)
       if (*copy_in == 0) {
         I8(local_copy)(*db, dd, F90_LBASE_G(dd)-1, *ab, ad, 
                                F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_OUT);
+        COPY_STAT(0, F90_GSIZE_G(dd) * F90_LEN_G(dd));
       }
 
       I8(__fort_dealloc)(*db, 0, __fort_gfree);
@@ -2236,6 +2352,7 @@ ENTF90(COPY_F90_ARGL, copy_f90_argl)(char **ab, F90_Desc *ad, char **db,
 
       I8(local_copy)(*db, dd, F90_LBASE_G(dd)-1, *ab, ad, 
                             F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_IN);
+      COPY_STAT(nbr_elem * F90_LEN_G(dd), 0);
     }
   } else {
     if (F90_DIM_SSTRIDE_G(ad, 0) == 1 && F90_DIM_LSTRIDE_G(ad, 0) == 1 &&
@@ -2245,6 +2362,7 @@ ENTF90(COPY_F90_ARGL, copy_f90_argl)(char **ab, F90_Desc *ad, char **db,
       if (*copy_in == 0) {
         I8(local_copy)(*db, dd, F90_LBASE_G(dd)-1, *ab, ad, 
                                F90_LBASE_G(ad)-1, F90_RANK_G(ad), __COPY_OUT);
+        COPY_STAT(0, F90_GSIZE_G(dd) * F90_LEN_G(dd));
       }
 
       I8(__fort_dealloc)(*db, 0, __fort_gfree);
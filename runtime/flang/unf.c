@@ -12,6 +12,9 @@
  */
 
 #include <string.h>
+#if !defined(WINNT)
+#include <unistd.h>
+#endif
 #include "global.h"
 #include "fioMacros.h"
 #include "async.h"
@@ -24,6 +27,8 @@ extern int __f90io_usw_write(int, long, int, char *, __CLEN_T);
 extern int __f90io_usw_end(void);
 static int skip_to_nextrec(void);
 static bool unf_fwrite(char *, size_t, size_t, FIO_FCB *);
+static int unf_fread(char *, size_t, FIO_FCB *);
+static int unf_zeropad(long);
 
 /* define a few things for run-time tracing */
 static int dbgflag;
@@ -104,6 +109,50 @@ typedef struct {
 
 static unf_rec_struct unf_rec;
 
+/*
+ * A sequential record that outgrows unf_rec.buf is assembled in recbuf
+ * (length word, data, room for the trailing length word), so that it can
+ * be written in one piece once its length is known instead of being
+ * flushed early and having its length patched by seeking back.  Records
+ * whose first item alone overflows unf_rec.buf are written directly as
+ * before, and so are records that grow past REC_GROW_MAX.
+ */
+#define REC_GROW_MAX (16 << 20)
+
+static char *recbuf;       /* grown record buffer */
+static size_t recbuf_size; /* data capacity of recbuf */
+static bool rec_grown;     /* the current record is in recbuf */
+static bool rec_swapped;   /* ... and its length word is byte swapped */
+
+#define REC_DATA (rec_grown ? recbuf + RCWSZ : unf_rec.buf)
+#define REC_ROOM (rec_grown ? recbuf_size : IOBUFSIZE)
+
+/*
+ * Direct access unformatted units with Fcb->pio set are read and written
+ * with pread and pwrite at Fcb->recpos, so a statement never seeks the
+ * unit's FILE nor flushes or refills its buffer.  Small reads, such as the
+ * items of an implied-do, are served from pio_win, which holds up to
+ * IOBUFSIZE bytes of the current record; it is dropped at the start of
+ * each statement and by any write.
+ */
+static struct {
+  FIO_FCB *fcb;     /* unit the window belongs to, or NULL */
+  seekoffx_t off;   /* file offset of buf[0] */
+  size_t len;       /* # of valid bytes in buf */
+  char buf[IOBUFSIZE];
+} pio_win;
+
+/*
+ * With FORTRANOPT=stream_direct, transfers of at least STREAM_DIRECT_MIN
+ * bytes on stream and binary units go straight between the file and the
+ * user's data with pread and pwrite at the position of the unit's FILE,
+ * which is then moved past them.  Smaller transfers use the stdio buffer.
+ */
+#define STREAM_DIRECT_MIN (64 << 10)
+#define STREAM_DIRECT(fcb, size)                                               \
+  ((fcb)->binary && !(fcb)->ispipe && !(fcb)->asy_rw &&                       \
+   (size) >= STREAM_DIRECT_MIN && __fortio_stream_direct())
+
 typedef struct {
   FIO_FCB *Fcb;
   char *buf_ptr;
@@ -127,10 +176,12 @@ static int gbl_avl = 0;
 static int gbl_size = GBL_SIZE;
 
 #define WRITE_UNF_LEN (unf_fwrite((char *)&unf_rec.u.s.bytecnt, RCWSZ, 1, Fcb) != TRUE)
-#define WRITE_UNF_REC \
-  (unf_fwrite((char *)&unf_rec.u.s.bytecnt, rw_size + RCWSZ, 1, Fcb) != TRUE)
+#define WRITE_UNF_REC write_unf_rec(unf_rec.u.s.bytecnt, FALSE)
 #define WRITE_UNF_BUF write_unf_buf()
 
+static bool write_unf_rec(int, bool);
+static void rec_spill(void);
+
 static int
 adjust_fpos(FIO_FCB *cur_file, long offset, int whence)
 {
@@ -149,6 +200,8 @@ save_gbl()
 {
   int buffOffset;
   if (gbl_avl) {
+    if (rec_grown)
+      rec_spill();
     gbl->Fcb = Fcb;
     gbl->rw_size = rw_size;
     gbl->rec_len = rec_len;
@@ -180,6 +233,7 @@ restore_gbl()
     memcpy(&unf_rec, &(gbl->unf_rec), sizeof(unf_rec_struct));
     buffOffset = gbl->buf_ptr - gbl->unf_rec.buf;
     buf_ptr = unf_rec.buf + buffOffset;
+    rec_grown = FALSE;
     has_same_fcb = gbl->has_same_fcb;
   }
 }
@@ -223,14 +277,323 @@ free_gbl()
 static bool
 write_unf_buf()
 {
-  if (rw_size && (unf_fwrite(unf_rec.buf, rw_size, 1, Fcb) != TRUE))
+  if (rw_size && (unf_fwrite(REC_DATA, rw_size, 1, Fcb) != TRUE))
     return TRUE;
   return FALSE;
 }
 
+/** \brief
+ * Write the length word len followed by the buffered data of the current
+ * record and, if trailer, len again, in a single write; return TRUE if an
+ * error occurred.
+ */
+static bool
+write_unf_rec(int len, bool trailer)
+{
+  char *p;
+  size_t n = RCWSZ + rw_size;
+
+  if (rec_grown) {
+    p = recbuf;
+  } else if (len == unf_rec.u.s.bytecnt) {
+    p = (char *)&unf_rec.u.s.bytecnt;
+  } else {
+    /* a swapped length word can't go in front of unf_rec.buf */
+    if (unf_fwrite((char *)&len, RCWSZ, 1, Fcb) != TRUE || write_unf_buf())
+      return TRUE;
+    return trailer && unf_fwrite((char *)&len, RCWSZ, 1, Fcb) != TRUE;
+  }
+  memcpy(p, &len, RCWSZ);
+  if (trailer) {
+    /* unf_rec.pad makes room for this after a full unf_rec.buf */
+    memcpy(p + n, &len, RCWSZ);
+    n += RCWSZ;
+  }
+  return unf_fwrite(p, n, 1, Fcb) != TRUE;
+}
+
+/** \brief
+ * Make room in the record buffer for nbytes more data of the record being
+ * written, moving the record to recbuf or growing recbuf; return FALSE if
+ * the record has to be flushed instead.
+ */
+static bool
+rec_room(size_t nbytes, bool swapped)
+{
+  size_t need = rw_size + nbytes;
+  size_t size;
+  char *p;
+
+  if (!rec_in_buf || has_same_fcb || Fcb->binary || Fcb->asy_rw ||
+      rw_size == 0 || need > REC_GROW_MAX)
+    return FALSE;
+  if (need > recbuf_size) {
+    size = recbuf_size ? recbuf_size : IOBUFSIZE * 16;
+    while (size < need)
+      size <<= 1;
+    if (size > REC_GROW_MAX)
+      size = REC_GROW_MAX;
+    p = realloc(recbuf, size + 2 * RCWSZ);
+    if (p == NULL)
+      return FALSE;
+    recbuf = p;
+    recbuf_size = size;
+  }
+  if (!rec_grown) {
+    memcpy(recbuf + RCWSZ, unf_rec.buf, rw_size);
+    rec_grown = TRUE;
+    rec_swapped = swapped;
+  }
+  buf_ptr = recbuf + RCWSZ + rw_size;
+  return TRUE;
+}
+
+/** \brief
+ * Write out the part of a record assembled in recbuf, the way a record
+ * that overflows unf_rec.buf is; used before a recursive i/o statement
+ * takes over the globals.
+ */
+static void
+rec_spill(void)
+{
+  int len = unf_rec.u.s.bytecnt;
+
+  if (rec_swapped)
+    __fortio_swap_bytes((char *)&len, __INT, 1);
+  if (write_unf_rec(len, FALSE))
+    (void)__fortio_error(__io_errno());
+  rec_in_buf = FALSE;
+  unf_rec.u.s.bcnt = unf_rec.u.s.bytecnt;
+  rw_size = 0;
+  buf_ptr = unf_rec.buf;
+  rec_grown = FALSE;
+}
+
+#if !defined(WINNT)
+/** \brief
+ * pwrite size bytes at fcb->recpos; return TRUE if all were written.
+ */
+static bool
+pio_write(char *buf, size_t size, FIO_FCB *fcb)
+{
+  int fd = __fort_getfd(fcb->fp);
+  ssize_t n;
+
+  pio_win.fcb = NULL;
+  while (size > 0) {
+    n = pwrite(fd, buf, size, fcb->recpos);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return FALSE;
+    }
+    buf += n;
+    size -= n;
+    fcb->recpos += n;
+  }
+  return TRUE;
+}
+
+/** \brief
+ * pread size bytes at fcb->recpos, through pio_win when size is small;
+ * return 0, FIO_EEOF if the file ends first, or an error number.
+ */
+static int
+pio_read(char *buf, size_t size, FIO_FCB *fcb)
+{
+  int fd = __fort_getfd(fcb->fp);
+  seekoffx_t end;
+  size_t k;
+  ssize_t n;
+
+  while (size > 0) {
+    if (pio_win.fcb == fcb && fcb->recpos >= pio_win.off &&
+        fcb->recpos < pio_win.off + (seekoffx_t)pio_win.len) {
+      k = pio_win.off + pio_win.len - fcb->recpos;
+      if (k > size)
+        k = size;
+      memcpy(buf, pio_win.buf + (fcb->recpos - pio_win.off), k);
+      buf += k;
+      size -= k;
+      fcb->recpos += k;
+      continue;
+    }
+    if (size >= IOBUFSIZE) {
+      n = pread(fd, buf, size, fcb->recpos);
+      if (n > 0) {
+        buf += n;
+        size -= n;
+        fcb->recpos += n;
+      }
+    } else {
+      /* fill the window, but not past the end of the record */
+      end = (seekoffx_t)fcb->reclen * (fcb->nextrec - 1);
+      k = end - fcb->recpos;
+      if (end <= fcb->recpos || k < size)
+        k = size;
+      else if (k > IOBUFSIZE)
+        k = IOBUFSIZE;
+      pio_win.fcb = NULL;
+      n = pread(fd, pio_win.buf, k, fcb->recpos);
+      if (n > 0) {
+        pio_win.fcb = fcb;
+        pio_win.off = fcb->recpos;
+        pio_win.len = n;
+      }
+    }
+    if (n == 0)
+      return FIO_EEOF;
+    if (n < 0 && errno != EINTR)
+      return __io_errno();
+  }
+  return 0;
+}
+
+/** \brief
+ * pread size bytes of a stream unit at the position of its FILE; return
+ * 0, FIO_EEOF if the file ends first, or an error number.
+ */
+static int
+stream_read(char *buf, size_t size, FIO_FCB *fcb)
+{
+  int fd = __fort_getfd(fcb->fp);
+  seekoffx_t pos = __io_ftellx(fcb->fp);
+  ssize_t n;
+  int err = 0;
+
+  if (pos < 0)
+    return __io_errno();
+  while (size > 0) {
+    n = pread(fd, buf, size, pos);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      err = __io_errno();
+      break;
+    }
+    if (n == 0) {
+      err = FIO_EEOF;
+      break;
+    }
+    buf += n;
+    size -= n;
+    pos += n;
+  }
+  if (__io_fseekx(fcb->fp, pos, SEEK_SET) != 0 && err == 0)
+    err = __io_errno();
+  return err;
+}
+
+/** \brief
+ * pwrite size bytes of a stream unit at the position of its FILE after
+ * flushing it; return TRUE if all were written.
+ */
+static bool
+stream_write(char *buf, size_t size, FIO_FCB *fcb)
+{
+  int fd = __fort_getfd(fcb->fp);
+  seekoffx_t pos;
+  ssize_t n;
+  bool ok = TRUE;
+
+  if (__io_fflush(fcb->fp) != 0 || (pos = __io_ftellx(fcb->fp)) < 0)
+    return FALSE;
+  while (size > 0) {
+    n = pwrite(fd, buf, size, pos);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      ok = FALSE;
+      break;
+    }
+    buf += n;
+    size -= n;
+    pos += n;
+  }
+  return __io_fseekx(fcb->fp, pos, SEEK_SET) == 0 && ok;
+}
+#endif
+
+/** \brief
+ * Read size bytes of the current record into buf; return 0, FIO_EEOF if
+ * the file ends first, or an error number.
+ */
+static int
+unf_fread(char *buf, size_t size, FIO_FCB *fcb)
+{
+#if !defined(WINNT)
+  if (fcb->pio || STREAM_DIRECT(fcb, size)) {
+    long long t0 = __fortio_stats_on ? __fortio_stats_xbegin() : 0;
+    int s = fcb->pio ? pio_read(buf, size, fcb) : stream_read(buf, size, fcb);
+
+    if (__fortio_stats_on)
+      __fortio_stats_xend(t0, s == 0 ? size : 0, FALSE);
+    return s;
+  }
+#endif
+  if (__io_fread(buf, size, 1, fcb->fp) != 1)
+    return __io_feof(fcb->fp) ? FIO_EEOF : __io_errno();
+  return 0;
+}
+
+/** \brief
+ * Pad the direct access record being written with len zero bytes; return
+ * 0 or an error number.
+ */
+static int
+unf_zeropad(long len)
+{
+#if !defined(WINNT)
+  static char zeros[IOBUFSIZE];
+  size_t n;
+
+  if (Fcb->pio) {
+    for (; len > 0; len -= n) {
+      n = len < IOBUFSIZE ? len : IOBUFSIZE;
+      if (pio_write(zeros, n, Fcb) != TRUE)
+        return __io_errno();
+    }
+    return 0;
+  }
+#endif
+  return __fortio_zeropad(Fcb->fp, len);
+}
+
+/** \brief
+ * When the zero padding of the direct access record being written fits
+ * in unf_rec.buf, append it there so that a pio unit writes the rest of
+ * the record with a single pwrite.
+ */
+static void
+pio_pad_buf(void)
+{
+  size_t pad;
+
+  if (!Fcb->pio || rec_grown || unf_rec.u.s.bytecnt >= Fcb->reclen)
+    return;
+  pad = Fcb->reclen - unf_rec.u.s.bytecnt;
+  if (rw_size + pad > IOBUFSIZE)
+    return;
+  memset(buf_ptr, 0, pad);
+  buf_ptr += pad;
+  rw_size += pad;
+  unf_rec.u.s.bytecnt = Fcb->reclen;
+}
+
 static bool
 unf_fwrite(char *buf, size_t size, size_t num, FIO_FCB *fcb)
 {
+#if !defined(WINNT)
+  if (fcb->pio || STREAM_DIRECT(fcb, size * num)) {
+    long long t0 = __fortio_stats_on ? __fortio_stats_xbegin() : 0;
+    bool ok = fcb->pio ? pio_write(buf, size * num, fcb)
+                       : stream_write(buf, size * num, fcb);
+
+    if (__fortio_stats_on)
+      __fortio_stats_xend(t0, ok ? size * num : 0, TRUE);
+    return ok;
+  }
+#endif
   if (fcb->asy_rw) {
     /* Do this write asynchronously. */
     return (Fio_asy_write(fcb->asyptr, buf, size * num) == 0);
@@ -346,13 +709,16 @@ __unf_init(bool read, bool byte_swap)
     rw_size = tmp_gbl->rw_size;
     continued = tmp_gbl->continued;
     has_same_fcb = 1;
+    rec_grown = FALSE;
     return 0;
 
   } else {
     io_transfer = FALSE;
     rec_in_buf = FALSE;
     buf_ptr = unf_rec.buf;
+    rec_grown = FALSE;
     unf_rec.u.s.bytecnt = 0;
+    pio_win.fcb = NULL;
     if (actual_init)
       has_same_fcb = 0;
   }
@@ -497,8 +863,8 @@ unf_read_do_resid:
       }
       return (0);
     }
-    if (__io_fread(item, nbytes, 1, Fcb->fp) != 1) {
-      if (__io_feof(Fcb->fp)) {
+    if ((ret_val = unf_fread(item, nbytes, Fcb)) != 0) {
+      if (ret_val == FIO_EEOF) {
         ret_val = __fortio_error(FIO_EEOF);
         if (Fcb->partial) {
           Fcb->partial = 0;
@@ -507,7 +873,7 @@ unf_read_do_resid:
           ret_val = __fortio_error(FIO_EEOF);
         }
       } else
-        ret_val = __fortio_error(__io_errno());
+        ret_val = __fortio_error(ret_val);
       goto unfr_err;
     }
 
@@ -537,11 +903,8 @@ unf_read_do_resid:
             bytes needed to fill the item (item_length - offset) */
     read_length =
         (nbytes < item_length - offset ? nbytes : item_length - offset);
-    if (__io_fread(item + offset, read_length, 1, Fcb->fp) != 1) {
-      if (__io_feof(Fcb->fp))
-        ret_val = __fortio_error(FIO_EEOF);
-      else
-        ret_val = __fortio_error(__io_errno());
+    if ((ret_val = unf_fread(item + offset, read_length, Fcb)) != 0) {
+      ret_val = __fortio_error(ret_val);
       goto unfr_err;
     }
     unf_rec.u.s.bytecnt += read_length;
@@ -812,7 +1175,8 @@ __f90io_unf_write(int type,   /* data type of data (see above). */
       resid = 0;
     }
     unf_rec.u.s.bytecnt += nbytes;
-    if (rw_size + nbytes > IOBUFSIZE || resid > 0) {
+    if (resid > 0 ||
+        (rw_size + nbytes > REC_ROOM && !rec_room(nbytes, FALSE))) {
       if (DBGBIT(0x4))
         __io_printf(("unit stride flush, rw_size=%" GBL_SIZE_T_FORMAT ", in_buf:%d\n"), rw_size,
                      rec_in_buf);
@@ -844,6 +1208,7 @@ __f90io_unf_write(int type,   /* data type of data (see above). */
       }
       rw_size = 0;
       buf_ptr = unf_rec.buf;
+      rec_grown = FALSE;
       if (resid > 0) {
         if ((ret_val = __unf_end(TO_BE_CONTINUED)) != 0) {
           goto unf_write_err;
@@ -886,7 +1251,8 @@ __f90io_unf_write(int type,   /* data type of data (see above). */
       rec_full = FALSE;
       unf_rec.u.s.bytecnt += item_length;
     }
-    if ((rw_size + item_length) >= IOBUFSIZE || rec_full) {
+    if (rec_full || ((rw_size + item_length) >= REC_ROOM &&
+                     !rec_room(item_length, FALSE))) {
       if (DBGBIT(0x4))
         __io_printf("non-unit stride flush, nbytes=%" GBL_SIZE_T_FORMAT ", in_buf:%d\n", rw_size,
                      rec_in_buf);
@@ -912,6 +1278,7 @@ __f90io_unf_write(int type,   /* data type of data (see above). */
       }
       rw_size = 0;
       buf_ptr = unf_rec.buf;
+      rec_grown = FALSE;
       if (rec_full) {
         /* Start a new record. */
         if ((ret_val = __unf_end(TO_BE_CONTINUED)) != 0) {
@@ -1171,8 +1538,10 @@ __unf_end(bool to_be_continued)
        */
       if (Fcb->acc != FIO_DIRECT)
         ret_err = __io_fseek(Fcb->fp, (seekoffx_t)rec_len + RCWSZ, SEEK_CUR);
-      else
+      else if (!Fcb->pio)
         ret_err = __io_fseek(Fcb->fp, (seekoffx_t)rec_len, SEEK_CUR);
+      else
+        ret_err = 0;
       if (ret_err)
         UNF_ERR(__io_errno());
       Fcb->coherent = 0;
@@ -1230,16 +1599,16 @@ __unf_end(bool to_be_continued)
         UNF_ERR(__io_errno());
       return 0;
     }
-    if (WRITE_UNF_REC)
-      UNF_ERR(__io_errno());
-    if (WRITE_UNF_LEN)
+    if (write_unf_rec(unf_rec.u.s.bytecnt, TRUE))
       UNF_ERR(__io_errno());
     return 0;
   }
 
-  if (!has_same_fcb)
+  if (!has_same_fcb) {
+    pio_pad_buf();
     if (WRITE_UNF_BUF)
       UNF_ERR(__io_errno());
+  }
   if (!has_same_fcb) {
     rw_size = 0;
     buf_ptr = unf_rec.buf;
@@ -1284,7 +1653,7 @@ __unf_end(bool to_be_continued)
       UNF_ERR(__io_errno());
   } else if (Fcb->reclen > unf_rec.u.s.bytecnt) {
     /*  pad record for direct-access file: */
-    ret_err = __fortio_zeropad(Fcb->fp, Fcb->reclen - unf_rec.u.s.bytecnt);
+    ret_err = unf_zeropad(Fcb->reclen - unf_rec.u.s.bytecnt);
     if (ret_err != 0)
       UNF_ERR(ret_err);
   }
@@ -1308,7 +1677,7 @@ skip_to_nextrec(void)
                       SEEK_CUR))
         return (__io_errno());
     }
-  } else if (unf_rec.u.s.bytecnt < rec_len) {
+  } else if (unf_rec.u.s.bytecnt < rec_len && !Fcb->pio) {
     Fcb->coherent = 0;
     if (__io_fseek(Fcb->fp, (seekoffx_t)(rec_len - unf_rec.u.s.bytecnt),
                     SEEK_CUR) != 0)
@@ -1476,11 +1845,8 @@ usw_read_do_resid:
   /* read directly into item if possible  (consecutive items) */
 
   if (stride == item_length) {
-    if (__io_fread(item_ptr, nbytes, 1, Fcb->fp) != 1) {
-      if (__io_feof(Fcb->fp))
-        ret_val = __fortio_error(FIO_EEOF);
-      else
-        ret_val = __fortio_error(__io_errno());
+    if ((ret_val = unf_fread(item_ptr, nbytes, Fcb)) != 0) {
+      ret_val = __fortio_error(ret_val);
       goto uswr_err;
     }
     unf_rec.u.s.bytecnt += nbytes;
@@ -1497,7 +1863,7 @@ usw_read_do_resid:
       io_transfer = TRUE;
       goto usw_read_do_resid;
     }
-      __fortio_swap_bytes(item, type, count);
+    __fortio_swap_copy(item, item, type, (size_t)count * item_length);
     return 0;
   }
 
@@ -1519,18 +1885,15 @@ usw_read_do_resid:
             bytes needed to fill the item (item_length - offset) */
     read_length =
         (nbytes < item_length - offset ? nbytes : item_length - offset);
-    if (__io_fread(item + offset, read_length, 1, Fcb->fp) != 1) {
-      if (__io_feof(Fcb->fp))
-        ret_val = __fortio_error(FIO_EEOF);
-      else
-        ret_val = __fortio_error(__io_errno());
+    if ((ret_val = unf_fread(item + offset, read_length, Fcb)) != 0) {
+      ret_val = __fortio_error(ret_val);
       goto uswr_err;
     }
     unf_rec.u.s.bytecnt += read_length;
     nbytes -= read_length;
     offset += read_length;
     if (offset == item_length) {
-        __fortio_swap_bytes(item_ptr, type, 1);
+      __fortio_swap_copy(item, item, type, item_length);
       item += stride;
       offset = 0;
     }
@@ -1678,6 +2041,54 @@ ENTF90IO(USW_READ64_A, usw_read64_a)
 
 /* ----------------------------------------------------------------- */
 
+/* Contiguous data too big for unf_rec.buf is swapped into a staging
+ * buffer and written from there, USW_STAGESIZE bytes at a time. */
+#define USW_STAGESIZE (1 << 20)
+
+static char *usw_stage;
+
+/** \brief
+ * Byte swap and write nbytes of contiguous data; return TRUE if an
+ * error occurred.
+ */
+static bool
+usw_fwrite(char *item, int type, size_t nbytes)
+{
+  size_t chunk;
+
+  if (type == __STR)
+    return unf_fwrite(item, nbytes, 1, Fcb) != TRUE;
+  if (Fcb->asy_rw) { /* the staging buffer is reused; stop any async i/o */
+    Fcb->asy_rw = 0;
+    if (Fio_asy_disable(Fcb->asyptr) == -1)
+      return TRUE;
+  }
+  if (usw_stage == NULL) {
+    usw_stage = malloc(USW_STAGESIZE);
+    if (usw_stage == NULL) {
+      /* fall back to swapping through unf_rec.buf */
+      while (nbytes) {
+        chunk = nbytes < IOBUFSIZE ? nbytes : IOBUFSIZE;
+        __fortio_swap_copy(unf_rec.buf, item, type, chunk);
+        if (unf_fwrite(unf_rec.buf, chunk, 1, Fcb) != TRUE)
+          return TRUE;
+        item += chunk;
+        nbytes -= chunk;
+      }
+      return FALSE;
+    }
+  }
+  while (nbytes) {
+    chunk = nbytes < USW_STAGESIZE ? nbytes : USW_STAGESIZE;
+    __fortio_swap_copy(usw_stage, item, type, chunk);
+    if (unf_fwrite(usw_stage, chunk, 1, Fcb) != TRUE)
+      return TRUE;
+    item += chunk;
+    nbytes -= chunk;
+  }
+  return FALSE;
+}
+
 int
 __f90io_usw_write(int type,   /* data type of data (see above). */
                   long count, /* number of items of specified type
@@ -1687,7 +2098,6 @@ __f90io_usw_write(int type,   /* data type of data (see above). */
                   __CLEN_T item_length)
 {
   long i;        /* loop index */
-  int j;         /* loop index */
   size_t nbytes; /* # of bytes to write for this call */
   int bs_tmp;
   int ret_val;
@@ -1725,7 +2135,8 @@ __f90io_usw_write(int type,   /* data type of data (see above). */
       nbytes -= resid;
     } else
       resid = 0;
-    if (rw_size + nbytes > IOBUFSIZE || resid > 0) {
+    if (resid > 0 ||
+        (rw_size + nbytes > REC_ROOM && !rec_room(nbytes, TRUE))) {
       if (DBGBIT(0x4))
         __io_printf("unit stride flush, rw_size=%" GBL_SIZE_T_FORMAT ", in_buf:%d\n", rw_size,
                      rec_in_buf);
@@ -1733,12 +2144,11 @@ __f90io_usw_write(int type,   /* data type of data (see above). */
         if (!Fcb->binary) {
           bs_tmp = unf_rec.u.s.bytecnt + nbytes;
           __fortio_swap_bytes((char *)&bs_tmp, __INT, 1);
-          if ((FWRITE(&bs_tmp, RCWSZ, 1, Fcb->fp)) != 1) {
+          if (write_unf_rec(bs_tmp, FALSE)) {
             ret_val = __fortio_error(__io_errno());
             goto unf_write_err;
           }
-        }
-        if (WRITE_UNF_BUF) {
+        } else if (WRITE_UNF_BUF) {
           ret_val = __fortio_error(__io_errno());
           goto unf_write_err;
         }
@@ -1750,17 +2160,29 @@ __f90io_usw_write(int type,   /* data type of data (see above). */
           goto unf_write_err;
         }
       }
-      if (DBGBIT(0x4))
-        __io_printf("to nonunit stride copy, nbytes=%" GBL_SIZE_T_FORMAT "\n", nbytes);
       rw_size = 0;
       buf_ptr = unf_rec.buf;
-      goto nonunit_cp;
+      rec_grown = FALSE;
+      if (resid > 0) {
+        if (DBGBIT(0x4))
+          __io_printf("to nonunit stride copy, nbytes=%" GBL_SIZE_T_FORMAT "\n",
+                      nbytes);
+        goto nonunit_cp;
+      }
+      if (DBGBIT(0x4))
+        __io_printf("unit stride swapped write, nbytes=%" GBL_SIZE_T_FORMAT "\n",
+                    nbytes);
+      if (usw_fwrite(item, type, nbytes)) {
+        ret_val = __fortio_error(__io_errno());
+        goto unf_write_err;
+      }
+      unf_rec.u.s.bytecnt += nbytes;
+      return 0;
     }
     if (DBGBIT(0x4))
       __io_printf("unit stride copy, nbytes=%" GBL_SIZE_T_FORMAT ", rw_size=%" GBL_SIZE_T_FORMAT ", in_buf:%d\n",
                    nbytes, rw_size, rec_in_buf);
-    (void) memcpy(buf_ptr, item, nbytes);
-      __fortio_swap_bytes(buf_ptr, type, count);
+    __fortio_swap_copy(buf_ptr, item, type, nbytes);
     unf_rec.u.s.bytecnt += nbytes;
     buf_ptr += nbytes;
     rw_size += nbytes;
@@ -1779,7 +2201,8 @@ nonunit_cp:
       rec_full = FALSE;
       unf_rec.u.s.bytecnt += item_length;
     }
-    if ((rw_size + item_length) >= IOBUFSIZE || rec_full) {
+    if (rec_full || ((rw_size + item_length) >= REC_ROOM &&
+                     !rec_room(item_length, TRUE))) {
       if (DBGBIT(0x4))
         __io_printf("non-unit stride flush, nbytes=%" GBL_SIZE_T_FORMAT ", in_buf:%d\n", rw_size,
                      rec_in_buf);
@@ -1787,12 +2210,11 @@ nonunit_cp:
         if (!Fcb->binary) {
           bs_tmp = unf_rec.u.s.bytecnt;
           __fortio_swap_bytes((char *)&bs_tmp, __INT, 1);
-          if ((FWRITE(&bs_tmp, RCWSZ, 1, Fcb->fp)) != 1) {
+          if (write_unf_rec(bs_tmp, FALSE)) {
             ret_val = __fortio_error(__io_errno());
             goto unf_write_err;
           }
-        }
-        if (WRITE_UNF_BUF) {
+        } else if (WRITE_UNF_BUF) {
           ret_val = __fortio_error(__io_errno());
           goto unf_write_err;
         }
@@ -1806,6 +2228,7 @@ nonunit_cp:
       }
       rw_size = 0;
       buf_ptr = unf_rec.buf;
+      rec_grown = FALSE;
       if (rec_full) {
         /* Start a new record. */
         if ((ret_val = __usw_end(TO_BE_CONTINUED)) != 0)
@@ -1832,7 +2255,7 @@ nonunit_cp:
             return __fortio_error(FIO_ENOMEM);
           (void) memcpy(pp, item, item_length);
           __fortio_swap_bytes(pp, type, item_length >> 1);
-          if ((FWRITE(pp, item_length, 1, Fcb->fp)) != 1) {
+          if ((unf_fwrite(pp, item_length, 1, Fcb)) != TRUE) {
             ret_val = __fortio_error(__io_errno());
             goto unf_write_err;
           }
@@ -1842,10 +2265,9 @@ nonunit_cp:
         continue;
       }
     }
-    /* ??? one copy per byte.  Maybe optimize later */
-    for (j = 0; j < item_length; j++)
-      *buf_ptr++ = *item++;
-      __fortio_swap_bytes(buf_ptr - item_length, type, 1);
+    __fortio_swap_copy(buf_ptr, item, type, item_length);
+    buf_ptr += item_length;
+    item += item_length;
 
     rw_size += item_length;
   }
@@ -2013,8 +2435,10 @@ __usw_end(bool to_be_continued)
        */
       if (Fcb->acc != FIO_DIRECT)
         ret_err = __io_fseek(Fcb->fp, (seekoffx_t)rec_len + RCWSZ, SEEK_CUR);
-      else
+      else if (!Fcb->pio)
         ret_err = __io_fseek(Fcb->fp, (seekoffx_t)rec_len, SEEK_CUR);
+      else
+        ret_err = 0;
       if (ret_err)
         UNF_ERR(__io_errno());
       Fcb->coherent = 0;
@@ -2075,15 +2499,12 @@ __usw_end(bool to_be_continued)
     }
     bs_tmp = unf_rec.u.s.bytecnt;
     __fortio_swap_bytes((char *)&bs_tmp, __INT, 1);
-    if ((FWRITE(&bs_tmp, RCWSZ, 1, Fcb->fp)) != 1)
-      UNF_ERR(__io_errno());
-    if (WRITE_UNF_BUF)
-      UNF_ERR(__io_errno());
-    if ((FWRITE(&bs_tmp, RCWSZ, 1, Fcb->fp)) != 1)
+    if (write_unf_rec(bs_tmp, TRUE))
       UNF_ERR(__io_errno());
     return 0;
   }
 
+  pio_pad_buf();
   if (WRITE_UNF_BUF)
     UNF_ERR(__io_errno());
   rw_size = 0;
@@ -2121,7 +2542,7 @@ __usw_end(bool to_be_continued)
       UNF_ERR(__io_errno());
   } else if (Fcb->reclen > unf_rec.u.s.bytecnt) {
     /*  pad record for direct-access file: */
-    ret_err = __fortio_zeropad(Fcb->fp, Fcb->reclen - unf_rec.u.s.bytecnt);
+    ret_err = unf_zeropad(Fcb->reclen - unf_rec.u.s.bytecnt);
     if (ret_err != 0)
       UNF_ERR(ret_err);
   }
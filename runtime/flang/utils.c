@@ -10,6 +10,8 @@
  */
 
 #include <errno.h>
+#include <stdint.h>
+#include <string.h>
 #include "global.h"
 #include "open_close.h"
 #include "stdioInterf.h"
@@ -255,6 +257,12 @@ extern FIO_FCB *__fortio_rwinit(
 
     if (f->acc == FIO_DIRECT) {
       assert(f->reclen > 0);
+#if !defined(WINNT)
+      /* Unformatted records are transferred with pread and pwrite at an
+       * offset kept in the FCB (see unf.c), so fp is never positioned.
+       */
+      f->pio = form == FIO_UNFORMATTED && f->asyptr == NULL && !f->ispipe;
+#endif
 
       if (!rec_specified || rec == 0)
         /* since rec not specified, assume the next record */
@@ -311,7 +319,9 @@ extern FIO_FCB *__fortio_rwinit(
           f->maxrec = len / f->reclen;
         } /* Now go to next if-check with recomputed maxrec */
 
-        if (rec <= f->maxrec + 1) {
+        if (f->pio) {
+          /* pwrite past the end leaves a hole that reads as zeros */
+        } else if (rec <= f->maxrec + 1) {
           pos = f->reclen * (rec - 1);
           if (__io_fseek(f->fp, (seekoffx_t)pos, SEEK_SET) != 0)
             ERR(__io_errno());
@@ -346,10 +356,14 @@ extern FIO_FCB *__fortio_rwinit(
           f->coherent = 1;
         }
       }
+      if (f->pio)
+        f->recpos = (seekoffx_t)f->reclen * (rec - 1);
       if (optype == 0 /*read*/ && form == FIO_FORMATTED)
         f->nextrec = rec;
       else
         f->nextrec = rec + 1;
+      if (__fortio_stats_on)
+        __fortio_stats_rec(rec);
 
       if (rec > f->maxrec)
         f->maxrec = rec;
@@ -404,7 +418,7 @@ extern FIO_FCB *__fortio_rwinit(
       flushed.  NOTE: coherent is set to 0 by open and rewind. */
 
   if (optype != 2) {
-    if (f->coherent && (f->coherent != 2 - optype)) {
+    if (f->coherent && (f->coherent != 2 - optype) && !f->pio) {
       (void)__io_fseek(f->fp, 0L, SEEK_CUR);
       f->skip = 0;
     }
@@ -502,12 +516,169 @@ extern bool __fortio_eq_str(
 
 /* ---------------------------------------------------------------------- */
 
-#define SWAPB(p, b1, b2, tmp) \
-  {                           \
-    tmp = p[b1];              \
-    p[b1] = p[b2];            \
-    p[b2] = tmp;              \
+/*
+ * Byte swapping for CONVERT='BIG_ENDIAN' and friends.  The kernels copy
+ * n units of unit_sz bytes from src to dst reversing the bytes of each
+ * unit; dst may equal src.  On x86-64 a pshufb kernel (SSSE3, or AVX2 when
+ * the processor has it) does 16 or 32 bytes per step and the portable
+ * kernel finishes the tail.
+ */
+
+typedef void (*swap_kernel_t)(char *, const char *, int, size_t);
+
+static void
+swap_units(char *dst, const char *src, int unit_sz, size_t n)
+{
+  size_t i;
+  uint16_t h;
+  uint32_t w;
+  uint64_t d, d2;
+
+  switch (unit_sz) {
+  case 2:
+    for (i = 0; i < n; i++, src += 2, dst += 2) {
+      memcpy(&h, src, 2);
+      h = __builtin_bswap16(h);
+      memcpy(dst, &h, 2);
+    }
+    break;
+  case 4:
+    for (i = 0; i < n; i++, src += 4, dst += 4) {
+      memcpy(&w, src, 4);
+      w = __builtin_bswap32(w);
+      memcpy(dst, &w, 4);
+    }
+    break;
+  case 8:
+    for (i = 0; i < n; i++, src += 8, dst += 8) {
+      memcpy(&d, src, 8);
+      d = __builtin_bswap64(d);
+      memcpy(dst, &d, 8);
+    }
+    break;
+  case 16:
+    for (i = 0; i < n; i++, src += 16, dst += 16) {
+      memcpy(&d, src, 8);
+      memcpy(&d2, src + 8, 8);
+      d = __builtin_bswap64(d);
+      d2 = __builtin_bswap64(d2);
+      memcpy(dst, &d2, 8);
+      memcpy(dst + 8, &d, 8);
+    }
+    break;
+  default:
+    assert(0);
+  }
+}
+
+#if defined(TARGET_X8664) && defined(__GNUC__) && !defined(TARGET_WIN)
+#include <immintrin.h>
+#define SWAP_PSHUFB 1
+
+/* pshufb control vectors reversing each 2, 4, 8 and 16 byte unit of a
+ * 16-byte lane */
+static const char swap_masks[4][16] __attribute__((aligned(16))) = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+
+static int
+swap_mask_index(int unit_sz)
+{
+  return unit_sz == 2 ? 0 : unit_sz == 4 ? 1 : unit_sz == 8 ? 2 : 3;
+}
+
+__attribute__((target("ssse3"))) static void
+swap_units_ssse3(char *dst, const char *src, int unit_sz, size_t n)
+{
+  size_t nbytes = n * unit_sz;
+  __m128i mask = _mm_load_si128(
+      (const __m128i *)swap_masks[swap_mask_index(unit_sz)]);
+
+  for (; nbytes >= 16; nbytes -= 16, src += 16, dst += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)src);
+    _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(v, mask));
+  }
+  if (nbytes)
+    swap_units(dst, src, unit_sz, nbytes / unit_sz);
+}
+
+__attribute__((target("avx2"))) static void
+swap_units_avx2(char *dst, const char *src, int unit_sz, size_t n)
+{
+  size_t nbytes = n * unit_sz;
+  __m256i mask = _mm256_broadcastsi128_si256(_mm_load_si128(
+      (const __m128i *)swap_masks[swap_mask_index(unit_sz)]));
+
+  for (; nbytes >= 64; nbytes -= 64, src += 64, dst += 64) {
+    __m256i v0 = _mm256_loadu_si256((const __m256i *)src);
+    __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+    _mm256_storeu_si256((__m256i *)dst, _mm256_shuffle_epi8(v0, mask));
+    _mm256_storeu_si256((__m256i *)(dst + 32), _mm256_shuffle_epi8(v1, mask));
   }
+  if (nbytes)
+    swap_units_ssse3(dst, src, unit_sz, nbytes / unit_sz);
+}
+
+static swap_kernel_t
+swap_kernel(void)
+{
+  static swap_kernel_t kernel;
+
+  if (!kernel) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+      kernel = swap_units_avx2;
+    else if (__builtin_cpu_supports("ssse3"))
+      kernel = swap_units_ssse3;
+    else
+      kernel = swap_units;
+  }
+  return kernel;
+}
+#endif
+
+/** \brief Copy nbytes of data of the given type from src to dst, swapping
+ * the bytes of each item.  dst may equal src.  Complex items are swapped
+ * as pairs of reals; character data is copied unchanged.
+ */
+void
+__fortio_swap_copy(char *dst, char *src, int type, size_t nbytes)
+{
+  int unit_sz; /* basic size of item to be swapped */
+
+  switch (type) {
+  case __STR:
+    unit_sz = 1;
+    break;
+  case __CPLX8:
+    unit_sz = FIO_TYPE_SIZE(__REAL4);
+    break;
+  case __CPLX16:
+    unit_sz = FIO_TYPE_SIZE(__REAL8);
+    break;
+  case __CPLX32:
+    unit_sz = FIO_TYPE_SIZE(__REAL16);
+    break;
+  default:
+    unit_sz = FIO_TYPE_SIZE(type);
+    break;
+  }
+  if (unit_sz == 1) {
+    if (dst != src)
+      memcpy(dst, src, nbytes);
+    return;
+  }
+#if SWAP_PSHUFB
+  /* the vector kernels only pay off past a few units */
+  if (nbytes >= 64) {
+    swap_kernel()(dst, src, unit_sz, nbytes / unit_sz);
+    return;
+  }
+#endif
+  swap_units(dst, src, unit_sz, nbytes / unit_sz);
+}
 
 void __fortio_swap_bytes(
     /*
@@ -518,51 +689,26 @@ void __fortio_swap_bytes(
     int type, /* data type of item */
     long cnt) /* number of 'unit_sz' items to be swapped */
 {
-  char btmp;
-  int unit_sz; /* basic size of item to be swapped */
+  int item_sz;
 
   switch (type) {
   case __STR:
     return;
   case __CPLX8:
-    unit_sz = FIO_TYPE_SIZE(__REAL4);
-    cnt <<= 1;
+    item_sz = 2 * FIO_TYPE_SIZE(__REAL4);
     break;
   case __CPLX16:
-    unit_sz = FIO_TYPE_SIZE(__REAL8);
-    cnt <<= 1;
+    item_sz = 2 * FIO_TYPE_SIZE(__REAL8);
     break;
   case __CPLX32:
-    unit_sz = FIO_TYPE_SIZE(__REAL16);
-    cnt <<= 1;
+    item_sz = 2 * FIO_TYPE_SIZE(__REAL16);
     break;
   default:
-    unit_sz = FIO_TYPE_SIZE(type);
+    item_sz = FIO_TYPE_SIZE(type);
     break;
   }
-  while (cnt--) {
-    switch (unit_sz) {
-    case 1: /* byte */
-      return;
-    case 2: /* half-word */
-      SWAPB(p, 0, 1, btmp);
-      break;
-    case 4: /* word */
-      SWAPB(p, 0, 3, btmp);
-      SWAPB(p, 1, 2, btmp);
-      break;
-    case 8: /* double-word */
-      SWAPB(p, 0, 7, btmp);
-      SWAPB(p, 1, 6, btmp);
-      SWAPB(p, 2, 5, btmp);
-      SWAPB(p, 3, 4, btmp);
-      break;
-    default: /* error */
-      assert(0);
-      return;
-    }
-    p += unit_sz;
-  }
+  if (cnt > 0)
+    __fortio_swap_copy(p, p, type, (size_t)cnt * item_sz);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <pthread.h>
+#include <time.h>
 #include <stdioInterf.h>
 #include "komp.h"
 
@@ -80,6 +81,13 @@ static void __llcrit_atfork(void)
     fprintf(__io_stderr(), "The atfork not registered when it should be!\n");
 }
 
+/* When _mp_bcs_nest_timed is set (by the I/O statistics of libflang), the
+ * time threads wait for the nest lock is added to _mp_bcs_nest_wait, in
+ * nanoseconds.  The waiter updates it after taking the lock.
+ */
+int _mp_bcs_nest_timed;
+long long _mp_bcs_nest_wait;
+
 void
 _mp_bcs_nest(void)
 {
@@ -97,6 +105,18 @@ _mp_bcs_nest(void)
     }
     _mp_v(&nest_sem);
   }
+  if (_mp_bcs_nest_timed) {
+    struct timespec t0, t1;
+
+    if (omp_test_nest_lock(&nest_lock))
+      return;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    omp_set_nest_lock(&nest_lock);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    _mp_bcs_nest_wait += (t1.tv_sec - t0.tv_sec) * 1000000000LL +
+                         (t1.tv_nsec - t0.tv_nsec);
+    return;
+  }
   omp_set_nest_lock(&nest_lock);
 }
 
@@ -459,6 +479,119 @@ _mp_copypriv_kmpc(void *dest, void *src)
   }
 }
 
+/* Handler for __kmpc_reduce_nowait 'reduce_func' (-Mx,69,0x2000).
+ * See how we marshall data in exp_host_reduction() in expsmp.cpp: word 0 is
+ * the number of items, followed by (op | type << 8, count, address) for
+ * each item.  The codes are MP_REDOP and MP_REDTY in tools/shared/mp.h.
+ */
+enum { RED_ADD = 1, RED_MUL, RED_MAX, RED_MIN, RED_AND, RED_OR, RED_XOR };
+enum { RED_I1 = 1, RED_I2, RED_I4, RED_I8, RED_R4, RED_R8, RED_C8, RED_C16 };
+
+#define RED_LOOP(T, expr)                                                      \
+  {                                                                            \
+    T *l = (T *)lhs;                                                           \
+    const T *r = (const T *)rhs;                                               \
+    for (i = 0; i < n; ++i) {                                                  \
+      T a = l[i], b = r[i];                                                    \
+      l[i] = (expr);                                                           \
+    }                                                                          \
+  }
+
+/* integer add and multiply wrap around, so do them unsigned */
+#define RED_INT(T, UT)                                                         \
+  switch (op) {                                                                \
+  case RED_ADD: RED_LOOP(T, (T)((UT)a + (UT)b)) break;                         \
+  case RED_MUL: RED_LOOP(T, (T)((UT)a * (UT)b)) break;                         \
+  case RED_MAX: RED_LOOP(T, a > b ? a : b) break;                              \
+  case RED_MIN: RED_LOOP(T, a < b ? a : b) break;                              \
+  case RED_AND: RED_LOOP(T, a & b) break;                                      \
+  case RED_OR: RED_LOOP(T, a | b) break;                                       \
+  case RED_XOR: RED_LOOP(T, a ^ b) break;                                      \
+  }
+
+#define RED_REAL(T)                                                            \
+  switch (op) {                                                                \
+  case RED_ADD: RED_LOOP(T, a + b) break;                                      \
+  case RED_MUL: RED_LOOP(T, a * b) break;                                      \
+  case RED_MAX: RED_LOOP(T, a > b ? a : b) break;                              \
+  case RED_MIN: RED_LOOP(T, a < b ? a : b) break;                              \
+  }
+
+#define RED_CMPLX(T)                                                           \
+  switch (op) {                                                                \
+  case RED_ADD: RED_LOOP(T, a + b) break;                                      \
+  case RED_MUL: RED_LOOP(T, a * b) break;                                      \
+  }
+
+void
+_mp_reduce_kmpc(void *lhs_data, void *rhs_data)
+{
+  const int64_t *to = (const int64_t *)lhs_data;
+  const int64_t *from = (const int64_t *)rhs_data;
+  int64_t k, nitems = to[0];
+
+  for (k = 0; k < nitems; ++k) {
+    const int64_t *lit = to + 1 + 3 * k;
+    const int64_t *rit = from + 1 + 3 * k;
+    const int op = lit[0] & 0xff;
+    const int64_t n = lit[1];
+    void *lhs = (void *)(intptr_t)lit[2];
+    const void *rhs = (const void *)(intptr_t)rit[2];
+    int64_t i;
+
+    switch (lit[0] >> 8) {
+    case RED_I1:
+      RED_INT(signed char, unsigned char)
+      break;
+    case RED_I2:
+      RED_INT(short, unsigned short)
+      break;
+    case RED_I4:
+      RED_INT(int, unsigned int)
+      break;
+    case RED_I8:
+      RED_INT(long long, unsigned long long)
+      break;
+    case RED_R4:
+      RED_REAL(float)
+      break;
+    case RED_R8:
+      RED_REAL(double)
+      break;
+    case RED_C8:
+      RED_CMPLX(float _Complex)
+      break;
+    case RED_C16:
+      RED_CMPLX(double _Complex)
+      break;
+    }
+  }
+}
+
+/* __kmpc_reduce_nowait reads loc->flags to choose between its critical
+ * section and tree methods, so it needs a real (zeroed) ident.  One lock
+ * serves every host tree reduction, as nest_sem_red does for
+ * _mp_bcs_nest_red.
+ */
+static struct {
+  kmp_int32 reserved_1, flags, reserved_2, reserved_3;
+  const char *psource;
+} red_ident = {0, 0, 0, 0, ";unknown;unknown;0;0;;"};
+static kmp_critical_name sem_red;
+
+kmp_int32
+_mp_reduce_nowait(kmp_int32 nitems, size_t size, void *data)
+{
+  return __kmpc_reduce_nowait(&red_ident, __kmpc_global_thread_num(0), nitems,
+                              size, data, _mp_reduce_kmpc, &sem_red);
+}
+
+void
+_mp_end_reduce_nowait(void)
+{
+  __kmpc_end_reduce_nowait(&red_ident, __kmpc_global_thread_num(0), &sem_red);
+}
+
 /* duplicate kmpc_threadprivate_cached but we assume each thread has its own addr
  * in its own [tls] address space so that it does not need to access memory in other
  * thread's area. Use when experiment flag 69,0x80
@@ -186,5 +186,9 @@ extern void __kmpc_end_critical(ident_t *, kmp_int32, kmp_critical_name *);
 extern void* __kmpc_threadprivate_cached(ident_t *, kmp_int32, void*, size_t, void*** );
 extern void* __kmpc_threadprivate(ident_t *, kmp_int32, void*, size_t);
 extern void __kmpc_barrier(ident_t *, kmp_int32);
+extern kmp_int32 __kmpc_reduce_nowait(ident_t *, kmp_int32, kmp_int32, size_t,
+                                      void *, void (*)(void *, void *),
+                                      kmp_critical_name *);
+extern void __kmpc_end_reduce_nowait(ident_t *, kmp_int32, kmp_critical_name *);
 
 #endif /*_PGOMP_H*/
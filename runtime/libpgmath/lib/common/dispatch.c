@@ -236,6 +236,15 @@ static char *cfunc[] = {
         [func_ceil]     = "ceil",
         [func_floor]    = "floor",
 	[func_cotan]    = "cotan",
+        [func_erf]      = "erf",
+        [func_erfc]     = "erfc",
+        [func_erfc_scaled] = "erfc_scaled",
+        [func_gamma]    = "gamma",
+        [func_log_gamma] = "log_gamma",
+        [func_bessel_j0] = "bessel_j0",
+        [func_bessel_j1] = "bessel_j1",
+        [func_bessel_y0] = "bessel_y0",
+        [func_bessel_y1] = "bessel_y1",
 };
 
 #undef SLEEF
@@ -262,6 +271,9 @@ static char *cfunc[] = {
 #include "math_tables/mth_ceildefs.h"
 #include "math_tables/mth_floordefs.h"
 #include "math_tables/mth_cotandefs.h"
+#include "math_tables/mth_erfdefs.h"
+#include "math_tables/mth_gammadefs.h"
+#include "math_tables/mth_besseldefs.h"
 #ifdef SLEEF
 #include "math_tables/mth_sleef.h"
 #endif
@@ -305,6 +317,9 @@ static mth_intrins_defs_t mth_intrins_defs[] = {
 #include "math_tables/mth_ceildefs.h"
 #include "math_tables/mth_floordefs.h"
 #include "math_tables/mth_cotandefs.h"
+#include "math_tables/mth_erfdefs.h"
+#include "math_tables/mth_gammadefs.h"
+#include "math_tables/mth_besseldefs.h"
 #else
 #include "math_tables/mth_sleef.h"
 #endif
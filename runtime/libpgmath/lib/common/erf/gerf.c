@@ -0,0 +1,286 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/*
+ * Vector ERF, ERFC and ERFC_SCALED.
+ *
+ * Each lane uses W. J. Cody's rational approximation for the argument
+ * interval it falls in (the same coefficients as the scalar erfc_scaled.c).
+ * The approximations are evaluated for all lanes and blended, skipping
+ * only the intervals that no lane falls in, so neighbouring arguments from
+ * an array usually cost one approximation.  Single precision lanes are
+ * widened and computed in double precision, half a vector at a time.
+ *
+ * This file is compiled once for every PRECSIZE/VLEN pair, see
+ * CMakeLists.txt.
+ */
+
+#include "mth_intrinsics.h"
+
+#if PRECSIZE == 4
+#define PREC    s
+#define FLOAT   float
+#else
+#define PREC    d
+#define FLOAT   double
+#endif
+
+#define CONCAT4_(a,b,c,d) a##b##c##d
+#define CONCAT4(a,b,c,d) CONCAT4_(a,b,c,d)
+#define VFLOAT  CONCAT4(vr,PREC,VLEN,_t)
+#define GENERICNAME(f)  CONCAT4(__g,PREC,f,VLEN)
+
+/*
+ * The computation is done on vectors of DLEN doubles, as wide as the
+ * VFLOAT register, so single precision arguments are split in two halves.
+ */
+#if PRECSIZE == 4
+#define DLEN    (VLEN/2)
+#else
+#define DLEN    VLEN
+#endif
+
+typedef double  vdbl_t  __attribute__((vector_size(DLEN*sizeof(double))));
+typedef int64_t vlng_t  __attribute__((vector_size(DLEN*sizeof(int64_t))));
+
+#define ERF         0
+#define ERFC        1
+#define ERFC_SCALED 2
+
+/*  mathematical constants */
+#define sqrpi 5.6418958354775628695e-1
+#define thresh 0.46875e0
+
+/*  machine-dependent constants: ieee double precision values */
+#define xneg -26.628e0
+/*  erfc(x) underflows to zero for x >= xbig; Cody uses 26.543, which cuts
+ *  off the subnormal results that libm still returns */
+#define xbig 27.3e0
+#define xmax (1.0 / (1.77245385090551602729 * __DBL_MIN__))
+
+/*  coefficients for approximation to  erf  in first interval */
+static const double a[5] = {3.16112374387056560e00, 1.13864154151050156e02,
+                            3.77485237685302021e02, 3.20937758913846947e03,
+                            1.85777706184603153e-1};
+static const double b[4] = {2.36012909523441209e01, 2.44024637934444173e02,
+                            1.28261652607737228e03, 2.84423683343917062e03};
+
+/*  coefficients for approximation to  erfc  in second interval */
+static const double c[9] = {
+    5.64188496988670089e-1, 8.88314979438837594e00, 6.61191906371416295e01,
+    2.98635138197400131e02, 8.81952221241769090e02, 1.71204761263407058e03,
+    2.05107837782607147e03, 1.23033935479799725e03, 2.15311535474403846e-8};
+static const double d[8] = {1.57449261107098347e01, 1.17693950891312499e02,
+                            5.37181101862009858e02, 1.62138957456669019e03,
+                            3.29079923573345963e03, 4.36261909014324716e03,
+                            3.43936767414372164e03, 1.23033935480374942e03};
+
+/*  coefficients for approximation to  erfc  in third interval */
+static const double p[6] = {3.05326634961232344e-1, 3.60344899949804439e-1,
+                            1.25781726111229246e-1, 1.60837851487422766e-2,
+                            6.58749161529837803e-4, 1.63153871373020978e-2};
+static const double q[5] = {2.56852019228982242e00, 1.87295284992346047e00,
+                            5.27905102951428412e-1, 6.05183413124413191e-2,
+                            2.33520497626869185e-3};
+
+static inline __attribute__ ((always_inline)) vdbl_t
+vset(double v)
+{
+  return (vdbl_t){0} + v;
+}
+
+static inline __attribute__ ((always_inline)) vdbl_t
+vsel(vlng_t m, vdbl_t t, vdbl_t f)
+{
+  return (vdbl_t)(((vlng_t)t & m) | ((vlng_t)f & ~m));
+}
+
+/* True if any lane of m is set. */
+static inline __attribute__ ((always_inline)) int
+vany(vlng_t m)
+{
+  int64_t r = 0;
+  int i;
+
+  for (i = 0; i < DLEN; i++)
+    r |= m[i];
+  return r != 0;
+}
+
+/*
+ * exp(hi + lo) where lo is a small correction to hi.  hi is clamped to the
+ * range where the result neither overflows nor flushes to zero before the
+ * final scaling, which is done in two steps so that subnormal results are
+ * rounded only once.
+ */
+static inline __attribute__ ((always_inline)) vdbl_t
+vexp(vdbl_t hi, vdbl_t lo)
+{
+  const double shift = 0x1.8p52;
+  const double log2e = 1.44269504088896338700e+00;
+  const double ln2hi = 6.93147180369123816490e-01;
+  const double ln2lo = 1.90821492927058770002e-10;
+  vdbl_t t, k, r, e;
+  vlng_t ik, k1;
+
+  hi = vsel(hi < -745.2, vset(-745.2), hi);
+  hi = vsel(hi > 709.8, vset(709.8), hi);
+  t = hi * log2e + shift;
+  k = t - shift;
+  r = (hi - k * ln2hi) - k * ln2lo + lo;
+
+  e = r * (1.0 / 6227020800.0) + 1.0 / 479001600.0;
+  e = e * r + 1.0 / 39916800.0;
+  e = e * r + 1.0 / 3628800.0;
+  e = e * r + 1.0 / 362880.0;
+  e = e * r + 1.0 / 40320.0;
+  e = e * r + 1.0 / 5040.0;
+  e = e * r + 1.0 / 720.0;
+  e = e * r + 1.0 / 120.0;
+  e = e * r + 1.0 / 24.0;
+  e = e * r + 1.0 / 6.0;
+  e = e * r + 0.5;
+  e = e * r + 1.0;
+  e = e * r + 1.0;
+
+  ik = (vlng_t)t - (vlng_t)vset(shift);
+  k1 = ik >> 1;
+  e = e * (vdbl_t)((k1 + 1023) << 52);
+  return e * (vdbl_t)((ik - k1 + 1023) << 52);
+}
+
+static inline __attribute__ ((always_inline)) vdbl_t
+calerf(vdbl_t x, const int jint)
+{
+  vdbl_t y, yc, z, ys, del, xnum, xden, num, den, r, e, res;
+  vlng_t small, mid, big, huge, neg;
+  int i;
+
+  y = (vdbl_t)((vlng_t)x & 0x7fffffffffffffffLL);
+  small = y <= thresh;
+  mid = (y <= 4.0) & ~small;
+  big = ~(y <= 4.0);
+  huge = y > 0x1.0p27;
+  neg = x < 0.0;
+  num = den = vset(1.0);
+
+  /*  erf(x) = x * R1(x**2) for |x| <= 0.46875 */
+  if (vany(small)) {
+    z = y * y;
+    xnum = a[4] * z;
+    xden = z;
+    for (i = 0; i < 3; i++) {
+      xnum = (xnum + a[i]) * z;
+      xden = (xden + b[i]) * z;
+    }
+    num = vsel(small, x * (xnum + a[3]), num);
+    den = vsel(small, xden + b[3], den);
+  }
+
+  /*  exp(x**2) * erfc(|x|) = R2(|x|) for 0.46875 < |x| <= 4.0 */
+  if (vany(mid)) {
+    xnum = c[8] * y;
+    xden = y;
+    for (i = 0; i < 7; i++) {
+      xnum = (xnum + c[i]) * y;
+      xden = (xden + d[i]) * y;
+    }
+    num = vsel(mid, xnum + c[7], num);
+    den = vsel(mid, xden + d[7], den);
+  }
+
+  /*
+   *  exp(x**2) * erfc(|x|) = (1/sqrt(pi) - R3(1/x**2)/x**2) / |x|
+   *  for |x| > 4.0.  R3 is evaluated as a ratio of polynomials in x**2
+   *  rather than 1/x**2, which saves a division.  Beyond 2**27 the R3 term
+   *  is below half an ulp and the result is just 1/(sqrt(pi)*|x|).
+   */
+  if (vany(big)) {
+    yc = vsel(huge, vset(0x1.0p27), y);
+    z = yc * yc;
+    xnum = p[4] * z;
+    xden = q[4] * z;
+    for (i = 3; i >= 0; i--) {
+      xnum = (xnum + p[i]) * z;
+      xden = (xden + q[i]) * z;
+    }
+    xnum = xnum + p[5];
+    xden = (xden + 1.0) * z;
+    num = vsel(big, vsel(huge, vset(sqrpi), sqrpi * xden - xnum), num);
+    den = vsel(big, vsel(huge, y, xden * y), den);
+  }
+
+  /*  One division serves all three intervals. */
+  r = num / den;
+
+  /*
+   * exp(-x**2) is computed as exp(-ys**2 - del) with ys**2 exact, which
+   * keeps the rounding error of x**2 out of the exponent.
+   */
+  ys = (vdbl_t)((vlng_t)y & (int64_t)0xffffffff00000000ULL);
+  del = (y - ys) * (y + ys);
+
+  if (jint == ERFC_SCALED) {
+    e = vany(small | neg) ? vexp(ys * ys, del) : vset(0.0);
+    res = vsel(y > xmax, vset(0.0), r);
+    res = vsel(neg, e * 2.0 - res, res);
+    res = vsel(small, e * (1.0 - r), res);
+    res = vsel(x < xneg, vset(__DBL_MAX__), res);
+  } else {
+    res = vset(0.0);
+    if (vany(~small & (y < xbig)))
+      res = vsel(y < xbig, vexp(-(ys * ys), -del) * r, res);
+    if (jint == ERF) {
+      res = (0.5 - res) + 0.5;
+      res = vsel(neg, -res, res);
+      res = vsel(small, r, res);
+    } else {
+      res = vsel(neg, 2.0 - res, res);
+      res = vsel(small, 1.0 - r, res);
+    }
+  }
+  return vsel(x == x, res, x + x);
+}
+
+#if PRECSIZE == 4
+typedef float   vhlf_t  __attribute__((vector_size(DLEN*sizeof(float))));
+
+static inline __attribute__ ((always_inline)) VFLOAT
+CALERF(VFLOAT x, const int jint)
+{
+  union {
+    VFLOAT v;
+    vhlf_t h[2];
+  } u = {x};
+
+  u.h[0] = __builtin_convertvector(
+      calerf(__builtin_convertvector(u.h[0], vdbl_t), jint), vhlf_t);
+  u.h[1] = __builtin_convertvector(
+      calerf(__builtin_convertvector(u.h[1], vdbl_t), jint), vhlf_t);
+  return u.v;
+}
+#else
+#define CALERF(x, jint) calerf(x, jint)
+#endif
+
+VFLOAT
+GENERICNAME(_erf_)(VFLOAT x)
+{
+  return CALERF(x, ERF);
+}
+
+VFLOAT
+GENERICNAME(_erfc_)(VFLOAT x)
+{
+  return CALERF(x, ERFC);
+}
+
+VFLOAT
+GENERICNAME(_erfc_scaled_)(VFLOAT x)
+{
+  return CALERF(x, ERFC_SCALED);
+}
@@ -1515,6 +1515,1626 @@ MTH_DISPATCH_FUNC(__pd_cotan_2m)(vrd2_t x, vid2_t m)
   return (fptr(x, m));
 }
 
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_erf_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erf][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_erf_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erf][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_erf_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erf][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erf_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erf][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erf_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erf][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erf_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erf][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erf_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erf_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erf_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_erf_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erf][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_erf_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erf][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_erf_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erf][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erf_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erf][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erf_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erf][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erf_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erf][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erf_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erf_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erf_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_erfc_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_erfc_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_erfc_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erfc_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erfc_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erfc_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erfc_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erfc_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erfc_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_erfc_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_erfc_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_erfc_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erfc_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erfc_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erfc_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erfc_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erfc_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erfc_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_gamma][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_gamma][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_gamma][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_gamma][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_gamma][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_gamma][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_gamma][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_gamma][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_gamma][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_gamma][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_gamma][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_gamma][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_log_gamma][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ss,frp_f);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ss][frp_f];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ss,frp_r);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ss][frp_r];
+  return (fptr(x));
+}
+
+vrs1_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_1)(vrs1_t x)
+{
+  vrs1_t (*fptr)(vrs1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ss,frp_p);
+  fptr = (vrs1_t(*)(vrs1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ss][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4,frp_f);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4][frp_f];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4,frp_r);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4][frp_r];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_4)(vrs4_t x)
+{
+  vrs4_t (*fptr)(vrs4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4,frp_p);
+  fptr = (vrs4_t(*)(vrs4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4][frp_p];
+  return (fptr(x));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4m,frp_f);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4m,frp_r);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs4_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_4m)(vrs4_t x, vis4_t m)
+{
+  vrs4_t (*fptr)(vrs4_t, vis4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv4m,frp_p);
+  fptr = (vrs4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ds,frp_f);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ds][frp_f];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ds,frp_r);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ds][frp_r];
+  return (fptr(x));
+}
+
+vrd1_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_1)(vrd1_t x)
+{
+  vrd1_t (*fptr)(vrd1_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_ds,frp_p);
+  fptr = (vrd1_t(*)(vrd1_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_ds][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2,frp_f);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2][frp_f];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2,frp_r);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2][frp_r];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_2)(vrd2_t x)
+{
+  vrd2_t (*fptr)(vrd2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2,frp_p);
+  fptr = (vrd2_t(*)(vrd2_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2][frp_p];
+  return (fptr(x));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2m,frp_f);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2m,frp_r);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd2_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_2m)(vrd2_t x, vid2_t m)
+{
+  vrd2_t (*fptr)(vrd2_t, vid2_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv2m,frp_p);
+  fptr = (vrd2_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv2m][frp_p];
+  return (fptr(x, m));
+}
+
 vrs1_t
 MTH_DISPATCH_FUNC(__fs_cosh_1)(vrs1_t x)
 {
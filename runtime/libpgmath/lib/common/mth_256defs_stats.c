@@ -967,6 +967,1086 @@ MTH_DISPATCH_FUNC(__pd_cotan_4m)(vrd4_t x, vid4_t m)
   return (fptr(x, m));
 }
 
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erf_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erf][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erf_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erf][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erf_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erf][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erf_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erf_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erf_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erf_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erf][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erf_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erf][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erf_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erf][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erf_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erf_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erf_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erfc_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erfc_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erfc_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erfc_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erfc_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erfc_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erfc_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erfc_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erfc_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erfc_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erfc_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erfc_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_gamma][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_gamma][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_gamma][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_gamma][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_gamma][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_gamma][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8,frp_f);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8][frp_f];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8,frp_r);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8][frp_r];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_8)(vrs8_t x)
+{
+  vrs8_t (*fptr)(vrs8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8,frp_p);
+  fptr = (vrs8_t(*)(vrs8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8][frp_p];
+  return (fptr(x));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8m,frp_f);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8m,frp_r);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs8_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_8m)(vrs8_t x, vis8_t m)
+{
+  vrs8_t (*fptr)(vrs8_t, vis8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv8m,frp_p);
+  fptr = (vrs8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4,frp_f);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4][frp_f];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4,frp_r);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4][frp_r];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_4)(vrd4_t x)
+{
+  vrd4_t (*fptr)(vrd4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4,frp_p);
+  fptr = (vrd4_t(*)(vrd4_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4][frp_p];
+  return (fptr(x));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4m,frp_f);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4m,frp_r);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd4_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_4m)(vrd4_t x, vid4_t m)
+{
+  vrd4_t (*fptr)(vrd4_t, vid4_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv4m,frp_p);
+  fptr = (vrd4_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv4m][frp_p];
+  return (fptr(x, m));
+}
+
 vrs8_t
 MTH_DISPATCH_FUNC(__fs_cosh_8)(vrs8_t x)
 {
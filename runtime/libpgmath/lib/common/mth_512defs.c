@@ -967,6 +967,1086 @@ MTH_DISPATCH_FUNC(__pd_cotan_8m)(vrd8_t x, vid8_t m)
   return (fptr(x, m));
 }
 
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erf_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erf][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erf_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erf][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erf_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erf][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erf_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erf_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erf_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erf][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erf_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erf][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erf_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erf][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erf_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erf][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erf_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erf_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erf_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erf,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erf][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erfc_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erfc_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erfc_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erfc_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erfc_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erfc_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erfc_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erfc_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erfc_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erfc_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erfc_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erfc_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_erfc_scaled_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_erfc_scaled_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_erfc_scaled_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_erfc_scaled_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_erfc_scaled_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_erfc_scaled_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_erfc_scaled,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_erfc_scaled][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_gamma][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_gamma][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_gamma][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_gamma][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_gamma][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_gamma][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_gamma,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_gamma][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_log_gamma][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_log_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_log_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_log_gamma_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_log_gamma][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_log_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_log_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_log_gamma_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_log_gamma,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_log_gamma][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_j0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_j0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_j0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_j0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_j0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_j0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j0,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j0][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_j1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_j1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_j1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_j1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_j1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_j1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_j1,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_j1][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_y0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_y0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_y0_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_y0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_y0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_y0_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y0,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y0][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16,frp_f);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16][frp_f];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16,frp_r);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16][frp_r];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_16)(vrs16_t x)
+{
+  vrs16_t (*fptr)(vrs16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16,frp_p);
+  fptr = (vrs16_t(*)(vrs16_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16][frp_p];
+  return (fptr(x));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__fs_bessel_y1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16m,frp_f);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16m][frp_f];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__rs_bessel_y1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16m,frp_r);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16m][frp_r];
+  return (fptr(x, m));
+}
+
+vrs16_t
+MTH_DISPATCH_FUNC(__ps_bessel_y1_16m)(vrs16_t x, vis16_t m)
+{
+  vrs16_t (*fptr)(vrs16_t, vis16_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_sv16m,frp_p);
+  fptr = (vrs16_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_sv16m][frp_p];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8,frp_f);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8][frp_f];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8,frp_r);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8][frp_r];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_8)(vrd8_t x)
+{
+  vrd8_t (*fptr)(vrd8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8,frp_p);
+  fptr = (vrd8_t(*)(vrd8_t))MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8][frp_p];
+  return (fptr(x));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__fd_bessel_y1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8m,frp_f);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8m][frp_f];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__rd_bessel_y1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8m,frp_r);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8m][frp_r];
+  return (fptr(x, m));
+}
+
+vrd8_t
+MTH_DISPATCH_FUNC(__pd_bessel_y1_8m)(vrd8_t x, vid8_t m)
+{
+  vrd8_t (*fptr)(vrd8_t, vid8_t);
+  _MTH_I_INIT();
+  _MTH_I_STATS_INC(func_bessel_y1,sv_dv8m,frp_p);
+  fptr = (vrd8_t(*)())MTH_DISPATCH_TBL[func_bessel_y1][sv_dv8m][frp_p];
+  return (fptr(x, m));
+}
+
 vrs16_t
 MTH_DISPATCH_FUNC(__fs_cosh_16)(vrs16_t x)
 {
@@ -132,6 +132,15 @@ typedef enum {
 	func_ceil,
 	func_floor,
 	func_cotan,
+	func_erf,
+	func_erfc,
+	func_erfc_scaled,
+	func_gamma,
+	func_log_gamma,
+	func_bessel_j0,
+	func_bessel_j1,
+	func_bessel_y0,
+	func_bessel_y1,
 	func_size,
 } func_e;
 
@@ -0,0 +1,56 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/******************************************************************************
+ *                                                                            *
+ * Background:                                                                *
+ * The POWERPC ABI does not provide for tail calls. Thus, the math dispatch   *
+ * table processing incurs overhead with the saving and restoration of GPR 2  *
+ * that can severely affect application performance.  For POWERPC, we use an  *
+ * optimized assembly dispatch set of routines that make tail calls to all of *
+ * the routines defined in the math dispatch configuration files but do not   *
+ * saveand /restore GPR 2.                                                    *
+ *                                                                            *
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! *
+ *                                                                            *
+ * If any entry (routine <FUNC>) in any of the dispatch tables is not present *
+ * in i.e. not  satisfied by, libpgmath, in order to properly preserve/restore*
+ * GRP 2 when calling routine <FUNC>, the actual function must first be       *
+ * encapsulated in a routine present in libpgmath.                            *
+ *                                                                            *
+ * No doubt there are pathological cases that will show this engineering      *
+ * choice to be wrong, but current performance testing shows otherwise.       *
+ *                                                                            *
+ *****************************************************************************/
+
+MTHINTRIN(bessel_j0 , ss   , any       , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , any       , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , any       , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , any       , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , any       , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , any       , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , any       , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , any       , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , any       , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , any       , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , any       , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , any       , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , any       , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , any       , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , any       , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , any       , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , any       , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , any       , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , any       , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , any       , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , any       , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , any       , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , any       , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , any       , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
@@ -0,0 +1,49 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/******************************************************************************
+ *                                                                            *
+ * Background:                                                                *
+ * The POWERPC ABI does not provide for tail calls. Thus, the math dispatch   *
+ * table processing incurs overhead with the saving and restoration of GPR 2  *
+ * that can severely affect application performance.  For POWERPC, we use an  *
+ * optimized assembly dispatch set of routines that make tail calls to all of *
+ * the routines defined in the math dispatch configuration files but do not   *
+ * saveand /restore GPR 2.                                                    *
+ *                                                                            *
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! *
+ *                                                                            *
+ * If any entry (routine <FUNC>) in any of the dispatch tables is not present *
+ * in i.e. not  satisfied by, libpgmath, in order to properly preserve/restore*
+ * GRP 2 when calling routine <FUNC>, the actual function must first be       *
+ * encapsulated in a routine present in libpgmath.                            *
+ *                                                                            *
+ * No doubt there are pathological cases that will show this engineering      *
+ * choice to be wrong, but current performance testing shows otherwise.       *
+ *                                                                            *
+ *****************************************************************************/
+
+MTHINTRIN(erf         , ss   , any       , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , any       , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , any       , __gs_erf_4_f            , __gs_erf_4_r            , __gs_erf_4_p            ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , any       , __gd_erf_2_f            , __gd_erf_2_r            , __gd_erf_2_p            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , any       , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , any       , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , any       , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , any       , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , any       , __gs_erfc_4_f           , __gs_erfc_4_r           , __gs_erfc_4_p           ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , any       , __gd_erfc_2_f           , __gd_erfc_2_r           , __gd_erfc_2_p           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , any       , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , any       , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , any       , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , any       , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , any       , __gs_erfc_scaled_4_f    , __gs_erfc_scaled_4_r    , __gs_erfc_scaled_4_p    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , any       , __gd_erfc_scaled_2_f    , __gd_erfc_scaled_2_r    , __gd_erfc_scaled_2_p    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , any       , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , any       , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
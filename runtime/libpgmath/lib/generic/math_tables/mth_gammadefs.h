@@ -0,0 +1,42 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/******************************************************************************
+ *                                                                            *
+ * Background:                                                                *
+ * The POWERPC ABI does not provide for tail calls. Thus, the math dispatch   *
+ * table processing incurs overhead with the saving and restoration of GPR 2  *
+ * that can severely affect application performance.  For POWERPC, we use an  *
+ * optimized assembly dispatch set of routines that make tail calls to all of *
+ * the routines defined in the math dispatch configuration files but do not   *
+ * saveand /restore GPR 2.                                                    *
+ *                                                                            *
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! *
+ *                                                                            *
+ * If any entry (routine <FUNC>) in any of the dispatch tables is not present *
+ * in i.e. not  satisfied by, libpgmath, in order to properly preserve/restore*
+ * GRP 2 when calling routine <FUNC>, the actual function must first be       *
+ * encapsulated in a routine present in libpgmath.                            *
+ *                                                                            *
+ * No doubt there are pathological cases that will show this engineering      *
+ * choice to be wrong, but current performance testing shows otherwise.       *
+ *                                                                            *
+ *****************************************************************************/
+
+MTHINTRIN(gamma     , ss   , any       , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , any       , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , any       , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , any       , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , any       , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , any       , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , any       , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , any       , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , any       , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , any       , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , any       , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , any       , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
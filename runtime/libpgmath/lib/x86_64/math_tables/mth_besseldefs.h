@@ -0,0 +1,314 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+MTHINTRIN(bessel_j0 , ss   , em64t     , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , em64t     , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , em64t     , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , em64t     , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , em64t     , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , em64t     , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , sse4      , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , sse4      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , sse4      , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , sse4      , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , sse4      , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , sse4      , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , avx       , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , avx       , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , avx       , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , avx       , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8  , avx       , __gs_bessel_j0_8_f      , __gs_bessel_j0_8_r      , __gs_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4  , avx       , __gd_bessel_j0_4_f      , __gd_bessel_j0_4_r      , __gd_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , avx       , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , avx       , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8m , avx       , __fs_bessel_j0_8_mn     , __rs_bessel_j0_8_mn     , __ps_bessel_j0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4m , avx       , __fd_bessel_j0_4_mn     , __rd_bessel_j0_4_mn     , __pd_bessel_j0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , avxfma4   , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , avxfma4   , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , avxfma4   , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , avxfma4   , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8  , avxfma4   , __gs_bessel_j0_8_f      , __gs_bessel_j0_8_r      , __gs_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4  , avxfma4   , __gd_bessel_j0_4_f      , __gd_bessel_j0_4_r      , __gd_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , avxfma4   , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , avxfma4   , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8m , avxfma4   , __fs_bessel_j0_8_mn     , __rs_bessel_j0_8_mn     , __ps_bessel_j0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4m , avxfma4   , __fd_bessel_j0_4_mn     , __rd_bessel_j0_4_mn     , __pd_bessel_j0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , avx2      , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , avx2      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , avx2      , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , avx2      , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8  , avx2      , __gs_bessel_j0_8_f      , __gs_bessel_j0_8_r      , __gs_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4  , avx2      , __gd_bessel_j0_4_f      , __gd_bessel_j0_4_r      , __gd_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , avx2      , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , avx2      , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8m , avx2      , __fs_bessel_j0_8_mn     , __rs_bessel_j0_8_mn     , __ps_bessel_j0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4m , avx2      , __fd_bessel_j0_4_mn     , __rd_bessel_j0_4_mn     , __pd_bessel_j0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , avx512knl , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , avx512knl , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , avx512knl , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , avx512knl , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8  , avx512knl , __gs_bessel_j0_8_f      , __gs_bessel_j0_8_r      , __gs_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4  , avx512knl , __gd_bessel_j0_4_f      , __gd_bessel_j0_4_r      , __gd_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv16 , avx512knl , __gs_bessel_j0_16_f     , __gs_bessel_j0_16_r     , __gs_bessel_j0_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv8  , avx512knl , __gd_bessel_j0_8_f      , __gd_bessel_j0_8_r      , __gd_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , avx512knl , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , avx512knl , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8m , avx512knl , __fs_bessel_j0_8_mn     , __rs_bessel_j0_8_mn     , __ps_bessel_j0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4m , avx512knl , __fd_bessel_j0_4_mn     , __rd_bessel_j0_4_mn     , __pd_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv16m, avx512knl , __fs_bessel_j0_16_mn    , __rs_bessel_j0_16_mn    , __ps_bessel_j0_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv8m , avx512knl , __fd_bessel_j0_8_mn     , __rd_bessel_j0_8_mn     , __pd_bessel_j0_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j0 , ss   , avx512    , __mth_i_bessel_j0       , __mth_i_bessel_j0       , __mth_i_bessel_j0       ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , ds   , avx512    , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      , __mth_i_dbessel_j0      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4  , avx512    , __gs_bessel_j0_4_f      , __gs_bessel_j0_4_r      , __gs_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2  , avx512    , __gd_bessel_j0_2_f      , __gd_bessel_j0_2_r      , __gd_bessel_j0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8  , avx512    , __gs_bessel_j0_8_f      , __gs_bessel_j0_8_r      , __gs_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4  , avx512    , __gd_bessel_j0_4_f      , __gd_bessel_j0_4_r      , __gd_bessel_j0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv16 , avx512    , __gs_bessel_j0_16_f     , __gs_bessel_j0_16_r     , __gs_bessel_j0_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv8  , avx512    , __gd_bessel_j0_8_f      , __gd_bessel_j0_8_r      , __gd_bessel_j0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv4m , avx512    , __fs_bessel_j0_4_mn     , __rs_bessel_j0_4_mn     , __ps_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv2m , avx512    , __fd_bessel_j0_2_mn     , __rd_bessel_j0_2_mn     , __pd_bessel_j0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv8m , avx512    , __fs_bessel_j0_8_mn     , __rs_bessel_j0_8_mn     , __ps_bessel_j0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv4m , avx512    , __fd_bessel_j0_4_mn     , __rd_bessel_j0_4_mn     , __pd_bessel_j0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , sv16m, avx512    , __fs_bessel_j0_16_mn    , __rs_bessel_j0_16_mn    , __ps_bessel_j0_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_j0 , dv8m , avx512    , __fd_bessel_j0_8_mn     , __rd_bessel_j0_8_mn     , __pd_bessel_j0_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , em64t     , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , em64t     , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , em64t     , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , em64t     , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , em64t     , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , em64t     , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , sse4      , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , sse4      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , sse4      , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , sse4      , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , sse4      , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , sse4      , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , avx       , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , avx       , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , avx       , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , avx       , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8  , avx       , __gs_bessel_j1_8_f      , __gs_bessel_j1_8_r      , __gs_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4  , avx       , __gd_bessel_j1_4_f      , __gd_bessel_j1_4_r      , __gd_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , avx       , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , avx       , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8m , avx       , __fs_bessel_j1_8_mn     , __rs_bessel_j1_8_mn     , __ps_bessel_j1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4m , avx       , __fd_bessel_j1_4_mn     , __rd_bessel_j1_4_mn     , __pd_bessel_j1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , avxfma4   , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , avxfma4   , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , avxfma4   , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , avxfma4   , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8  , avxfma4   , __gs_bessel_j1_8_f      , __gs_bessel_j1_8_r      , __gs_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4  , avxfma4   , __gd_bessel_j1_4_f      , __gd_bessel_j1_4_r      , __gd_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , avxfma4   , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , avxfma4   , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8m , avxfma4   , __fs_bessel_j1_8_mn     , __rs_bessel_j1_8_mn     , __ps_bessel_j1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4m , avxfma4   , __fd_bessel_j1_4_mn     , __rd_bessel_j1_4_mn     , __pd_bessel_j1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , avx2      , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , avx2      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , avx2      , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , avx2      , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8  , avx2      , __gs_bessel_j1_8_f      , __gs_bessel_j1_8_r      , __gs_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4  , avx2      , __gd_bessel_j1_4_f      , __gd_bessel_j1_4_r      , __gd_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , avx2      , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , avx2      , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8m , avx2      , __fs_bessel_j1_8_mn     , __rs_bessel_j1_8_mn     , __ps_bessel_j1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4m , avx2      , __fd_bessel_j1_4_mn     , __rd_bessel_j1_4_mn     , __pd_bessel_j1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , avx512knl , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , avx512knl , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , avx512knl , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , avx512knl , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8  , avx512knl , __gs_bessel_j1_8_f      , __gs_bessel_j1_8_r      , __gs_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4  , avx512knl , __gd_bessel_j1_4_f      , __gd_bessel_j1_4_r      , __gd_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv16 , avx512knl , __gs_bessel_j1_16_f     , __gs_bessel_j1_16_r     , __gs_bessel_j1_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv8  , avx512knl , __gd_bessel_j1_8_f      , __gd_bessel_j1_8_r      , __gd_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , avx512knl , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , avx512knl , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8m , avx512knl , __fs_bessel_j1_8_mn     , __rs_bessel_j1_8_mn     , __ps_bessel_j1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4m , avx512knl , __fd_bessel_j1_4_mn     , __rd_bessel_j1_4_mn     , __pd_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv16m, avx512knl , __fs_bessel_j1_16_mn    , __rs_bessel_j1_16_mn    , __ps_bessel_j1_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv8m , avx512knl , __fd_bessel_j1_8_mn     , __rd_bessel_j1_8_mn     , __pd_bessel_j1_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_j1 , ss   , avx512    , __mth_i_bessel_j1       , __mth_i_bessel_j1       , __mth_i_bessel_j1       ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , ds   , avx512    , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      , __mth_i_dbessel_j1      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4  , avx512    , __gs_bessel_j1_4_f      , __gs_bessel_j1_4_r      , __gs_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2  , avx512    , __gd_bessel_j1_2_f      , __gd_bessel_j1_2_r      , __gd_bessel_j1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8  , avx512    , __gs_bessel_j1_8_f      , __gs_bessel_j1_8_r      , __gs_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4  , avx512    , __gd_bessel_j1_4_f      , __gd_bessel_j1_4_r      , __gd_bessel_j1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv16 , avx512    , __gs_bessel_j1_16_f     , __gs_bessel_j1_16_r     , __gs_bessel_j1_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv8  , avx512    , __gd_bessel_j1_8_f      , __gd_bessel_j1_8_r      , __gd_bessel_j1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv4m , avx512    , __fs_bessel_j1_4_mn     , __rs_bessel_j1_4_mn     , __ps_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv2m , avx512    , __fd_bessel_j1_2_mn     , __rd_bessel_j1_2_mn     , __pd_bessel_j1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv8m , avx512    , __fs_bessel_j1_8_mn     , __rs_bessel_j1_8_mn     , __ps_bessel_j1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv4m , avx512    , __fd_bessel_j1_4_mn     , __rd_bessel_j1_4_mn     , __pd_bessel_j1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , sv16m, avx512    , __fs_bessel_j1_16_mn    , __rs_bessel_j1_16_mn    , __ps_bessel_j1_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_j1 , dv8m , avx512    , __fd_bessel_j1_8_mn     , __rd_bessel_j1_8_mn     , __pd_bessel_j1_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , em64t     , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , em64t     , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , em64t     , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , em64t     , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , em64t     , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , em64t     , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , sse4      , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , sse4      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , sse4      , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , sse4      , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , sse4      , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , sse4      , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , avx       , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , avx       , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , avx       , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , avx       , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8  , avx       , __gs_bessel_y0_8_f      , __gs_bessel_y0_8_r      , __gs_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4  , avx       , __gd_bessel_y0_4_f      , __gd_bessel_y0_4_r      , __gd_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , avx       , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , avx       , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8m , avx       , __fs_bessel_y0_8_mn     , __rs_bessel_y0_8_mn     , __ps_bessel_y0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4m , avx       , __fd_bessel_y0_4_mn     , __rd_bessel_y0_4_mn     , __pd_bessel_y0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , avxfma4   , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , avxfma4   , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , avxfma4   , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , avxfma4   , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8  , avxfma4   , __gs_bessel_y0_8_f      , __gs_bessel_y0_8_r      , __gs_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4  , avxfma4   , __gd_bessel_y0_4_f      , __gd_bessel_y0_4_r      , __gd_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , avxfma4   , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , avxfma4   , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8m , avxfma4   , __fs_bessel_y0_8_mn     , __rs_bessel_y0_8_mn     , __ps_bessel_y0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4m , avxfma4   , __fd_bessel_y0_4_mn     , __rd_bessel_y0_4_mn     , __pd_bessel_y0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , avx2      , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , avx2      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , avx2      , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , avx2      , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8  , avx2      , __gs_bessel_y0_8_f      , __gs_bessel_y0_8_r      , __gs_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4  , avx2      , __gd_bessel_y0_4_f      , __gd_bessel_y0_4_r      , __gd_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , avx2      , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , avx2      , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8m , avx2      , __fs_bessel_y0_8_mn     , __rs_bessel_y0_8_mn     , __ps_bessel_y0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4m , avx2      , __fd_bessel_y0_4_mn     , __rd_bessel_y0_4_mn     , __pd_bessel_y0_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , avx512knl , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , avx512knl , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , avx512knl , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , avx512knl , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8  , avx512knl , __gs_bessel_y0_8_f      , __gs_bessel_y0_8_r      , __gs_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4  , avx512knl , __gd_bessel_y0_4_f      , __gd_bessel_y0_4_r      , __gd_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv16 , avx512knl , __gs_bessel_y0_16_f     , __gs_bessel_y0_16_r     , __gs_bessel_y0_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv8  , avx512knl , __gd_bessel_y0_8_f      , __gd_bessel_y0_8_r      , __gd_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , avx512knl , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , avx512knl , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8m , avx512knl , __fs_bessel_y0_8_mn     , __rs_bessel_y0_8_mn     , __ps_bessel_y0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4m , avx512knl , __fd_bessel_y0_4_mn     , __rd_bessel_y0_4_mn     , __pd_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv16m, avx512knl , __fs_bessel_y0_16_mn    , __rs_bessel_y0_16_mn    , __ps_bessel_y0_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv8m , avx512knl , __fd_bessel_y0_8_mn     , __rd_bessel_y0_8_mn     , __pd_bessel_y0_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y0 , ss   , avx512    , __mth_i_bessel_y0       , __mth_i_bessel_y0       , __mth_i_bessel_y0       ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , ds   , avx512    , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      , __mth_i_dbessel_y0      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4  , avx512    , __gs_bessel_y0_4_f      , __gs_bessel_y0_4_r      , __gs_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2  , avx512    , __gd_bessel_y0_2_f      , __gd_bessel_y0_2_r      , __gd_bessel_y0_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8  , avx512    , __gs_bessel_y0_8_f      , __gs_bessel_y0_8_r      , __gs_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4  , avx512    , __gd_bessel_y0_4_f      , __gd_bessel_y0_4_r      , __gd_bessel_y0_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv16 , avx512    , __gs_bessel_y0_16_f     , __gs_bessel_y0_16_r     , __gs_bessel_y0_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv8  , avx512    , __gd_bessel_y0_8_f      , __gd_bessel_y0_8_r      , __gd_bessel_y0_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv4m , avx512    , __fs_bessel_y0_4_mn     , __rs_bessel_y0_4_mn     , __ps_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv2m , avx512    , __fd_bessel_y0_2_mn     , __rd_bessel_y0_2_mn     , __pd_bessel_y0_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv8m , avx512    , __fs_bessel_y0_8_mn     , __rs_bessel_y0_8_mn     , __ps_bessel_y0_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv4m , avx512    , __fd_bessel_y0_4_mn     , __rd_bessel_y0_4_mn     , __pd_bessel_y0_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , sv16m, avx512    , __fs_bessel_y0_16_mn    , __rs_bessel_y0_16_mn    , __ps_bessel_y0_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_y0 , dv8m , avx512    , __fd_bessel_y0_8_mn     , __rd_bessel_y0_8_mn     , __pd_bessel_y0_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , em64t     , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , em64t     , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , em64t     , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , em64t     , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , em64t     , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , em64t     , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , sse4      , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , sse4      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , sse4      , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , sse4      , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , sse4      , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , sse4      , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , avx       , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , avx       , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , avx       , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , avx       , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8  , avx       , __gs_bessel_y1_8_f      , __gs_bessel_y1_8_r      , __gs_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4  , avx       , __gd_bessel_y1_4_f      , __gd_bessel_y1_4_r      , __gd_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , avx       , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , avx       , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8m , avx       , __fs_bessel_y1_8_mn     , __rs_bessel_y1_8_mn     , __ps_bessel_y1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4m , avx       , __fd_bessel_y1_4_mn     , __rd_bessel_y1_4_mn     , __pd_bessel_y1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , avxfma4   , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , avxfma4   , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , avxfma4   , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , avxfma4   , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8  , avxfma4   , __gs_bessel_y1_8_f      , __gs_bessel_y1_8_r      , __gs_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4  , avxfma4   , __gd_bessel_y1_4_f      , __gd_bessel_y1_4_r      , __gd_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , avxfma4   , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , avxfma4   , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8m , avxfma4   , __fs_bessel_y1_8_mn     , __rs_bessel_y1_8_mn     , __ps_bessel_y1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4m , avxfma4   , __fd_bessel_y1_4_mn     , __rd_bessel_y1_4_mn     , __pd_bessel_y1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , avx2      , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , avx2      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , avx2      , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , avx2      , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8  , avx2      , __gs_bessel_y1_8_f      , __gs_bessel_y1_8_r      , __gs_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4  , avx2      , __gd_bessel_y1_4_f      , __gd_bessel_y1_4_r      , __gd_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , avx2      , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , avx2      , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8m , avx2      , __fs_bessel_y1_8_mn     , __rs_bessel_y1_8_mn     , __ps_bessel_y1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4m , avx2      , __fd_bessel_y1_4_mn     , __rd_bessel_y1_4_mn     , __pd_bessel_y1_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , avx512knl , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , avx512knl , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , avx512knl , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , avx512knl , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8  , avx512knl , __gs_bessel_y1_8_f      , __gs_bessel_y1_8_r      , __gs_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4  , avx512knl , __gd_bessel_y1_4_f      , __gd_bessel_y1_4_r      , __gd_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv16 , avx512knl , __gs_bessel_y1_16_f     , __gs_bessel_y1_16_r     , __gs_bessel_y1_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv8  , avx512knl , __gd_bessel_y1_8_f      , __gd_bessel_y1_8_r      , __gd_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , avx512knl , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , avx512knl , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8m , avx512knl , __fs_bessel_y1_8_mn     , __rs_bessel_y1_8_mn     , __ps_bessel_y1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4m , avx512knl , __fd_bessel_y1_4_mn     , __rd_bessel_y1_4_mn     , __pd_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv16m, avx512knl , __fs_bessel_y1_16_mn    , __rs_bessel_y1_16_mn    , __ps_bessel_y1_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv8m , avx512knl , __fd_bessel_y1_8_mn     , __rd_bessel_y1_8_mn     , __pd_bessel_y1_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(bessel_y1 , ss   , avx512    , __mth_i_bessel_y1       , __mth_i_bessel_y1       , __mth_i_bessel_y1       ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , ds   , avx512    , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      , __mth_i_dbessel_y1      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4  , avx512    , __gs_bessel_y1_4_f      , __gs_bessel_y1_4_r      , __gs_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2  , avx512    , __gd_bessel_y1_2_f      , __gd_bessel_y1_2_r      , __gd_bessel_y1_2_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8  , avx512    , __gs_bessel_y1_8_f      , __gs_bessel_y1_8_r      , __gs_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4  , avx512    , __gd_bessel_y1_4_f      , __gd_bessel_y1_4_r      , __gd_bessel_y1_4_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv16 , avx512    , __gs_bessel_y1_16_f     , __gs_bessel_y1_16_r     , __gs_bessel_y1_16_p     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv8  , avx512    , __gd_bessel_y1_8_f      , __gd_bessel_y1_8_r      , __gd_bessel_y1_8_p      ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv4m , avx512    , __fs_bessel_y1_4_mn     , __rs_bessel_y1_4_mn     , __ps_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv2m , avx512    , __fd_bessel_y1_2_mn     , __rd_bessel_y1_2_mn     , __pd_bessel_y1_2_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv8m , avx512    , __fs_bessel_y1_8_mn     , __rs_bessel_y1_8_mn     , __ps_bessel_y1_8_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv4m , avx512    , __fd_bessel_y1_4_mn     , __rd_bessel_y1_4_mn     , __pd_bessel_y1_4_mn     ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , sv16m, avx512    , __fs_bessel_y1_16_mn    , __rs_bessel_y1_16_mn    , __ps_bessel_y1_16_mn    ,__math_dispatch_error)
+MTHINTRIN(bessel_y1 , dv8m , avx512    , __fd_bessel_y1_8_mn     , __rd_bessel_y1_8_mn     , __pd_bessel_y1_8_mn     ,__math_dispatch_error)
@@ -0,0 +1,237 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+MTHINTRIN(erf         , ss   , em64t     , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , em64t     , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , em64t     , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , em64t     , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , em64t     , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , em64t     , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , sse4      , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , sse4      , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , sse4      , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , sse4      , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , sse4      , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , sse4      , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , avx       , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , avx       , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , avx       , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , avx       , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8  , avx       , __gs_erf_8              , __gs_erf_8              , __gs_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4  , avx       , __gd_erf_4              , __gd_erf_4              , __gd_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , avx       , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , avx       , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8m , avx       , __fs_erf_8_mn           , __rs_erf_8_mn           , __ps_erf_8_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4m , avx       , __fd_erf_4_mn           , __rd_erf_4_mn           , __pd_erf_4_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , avxfma4   , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , avxfma4   , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , avxfma4   , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , avxfma4   , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8  , avxfma4   , __gs_erf_8              , __gs_erf_8              , __gs_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4  , avxfma4   , __gd_erf_4              , __gd_erf_4              , __gd_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , avxfma4   , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , avxfma4   , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8m , avxfma4   , __fs_erf_8_mn           , __rs_erf_8_mn           , __ps_erf_8_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4m , avxfma4   , __fd_erf_4_mn           , __rd_erf_4_mn           , __pd_erf_4_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , avx2      , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , avx2      , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , avx2      , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , avx2      , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8  , avx2      , __gs_erf_8              , __gs_erf_8              , __gs_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4  , avx2      , __gd_erf_4              , __gd_erf_4              , __gd_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , avx2      , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , avx2      , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8m , avx2      , __fs_erf_8_mn           , __rs_erf_8_mn           , __ps_erf_8_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4m , avx2      , __fd_erf_4_mn           , __rd_erf_4_mn           , __pd_erf_4_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , avx512knl , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , avx512knl , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , avx512knl , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , avx512knl , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8  , avx512knl , __gs_erf_8              , __gs_erf_8              , __gs_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4  , avx512knl , __gd_erf_4              , __gd_erf_4              , __gd_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv16 , avx512knl , __gs_erf_16             , __gs_erf_16             , __gs_erf_16             ,__math_dispatch_error)
+MTHINTRIN(erf         , dv8  , avx512knl , __gd_erf_8              , __gd_erf_8              , __gd_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , avx512knl , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , avx512knl , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8m , avx512knl , __fs_erf_8_mn           , __rs_erf_8_mn           , __ps_erf_8_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4m , avx512knl , __fd_erf_4_mn           , __rd_erf_4_mn           , __pd_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv16m, avx512knl , __fs_erf_16_mn          , __rs_erf_16_mn          , __ps_erf_16_mn          ,__math_dispatch_error)
+MTHINTRIN(erf         , dv8m , avx512knl , __fd_erf_8_mn           , __rd_erf_8_mn           , __pd_erf_8_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erf         , ss   , avx512    , __mth_i_erf             , __mth_i_erf             , __mth_i_erf             ,__math_dispatch_error)
+MTHINTRIN(erf         , ds   , avx512    , __mth_i_derf            , __mth_i_derf            , __mth_i_derf            ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4  , avx512    , __gs_erf_4              , __gs_erf_4              , __gs_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2  , avx512    , __gd_erf_2              , __gd_erf_2              , __gd_erf_2              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8  , avx512    , __gs_erf_8              , __gs_erf_8              , __gs_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4  , avx512    , __gd_erf_4              , __gd_erf_4              , __gd_erf_4              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv16 , avx512    , __gs_erf_16             , __gs_erf_16             , __gs_erf_16             ,__math_dispatch_error)
+MTHINTRIN(erf         , dv8  , avx512    , __gd_erf_8              , __gd_erf_8              , __gd_erf_8              ,__math_dispatch_error)
+MTHINTRIN(erf         , sv4m , avx512    , __fs_erf_4_mn           , __rs_erf_4_mn           , __ps_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv2m , avx512    , __fd_erf_2_mn           , __rd_erf_2_mn           , __pd_erf_2_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv8m , avx512    , __fs_erf_8_mn           , __rs_erf_8_mn           , __ps_erf_8_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , dv4m , avx512    , __fd_erf_4_mn           , __rd_erf_4_mn           , __pd_erf_4_mn           ,__math_dispatch_error)
+MTHINTRIN(erf         , sv16m, avx512    , __fs_erf_16_mn          , __rs_erf_16_mn          , __ps_erf_16_mn          ,__math_dispatch_error)
+MTHINTRIN(erf         , dv8m , avx512    , __fd_erf_8_mn           , __rd_erf_8_mn           , __pd_erf_8_mn           ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , em64t     , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , em64t     , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , em64t     , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , em64t     , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , em64t     , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , em64t     , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , sse4      , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , sse4      , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , sse4      , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , sse4      , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , sse4      , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , sse4      , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , avx       , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , avx       , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , avx       , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , avx       , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8  , avx       , __gs_erfc_8             , __gs_erfc_8             , __gs_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4  , avx       , __gd_erfc_4             , __gd_erfc_4             , __gd_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , avx       , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , avx       , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8m , avx       , __fs_erfc_8_mn          , __rs_erfc_8_mn          , __ps_erfc_8_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4m , avx       , __fd_erfc_4_mn          , __rd_erfc_4_mn          , __pd_erfc_4_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , avxfma4   , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , avxfma4   , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , avxfma4   , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , avxfma4   , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8  , avxfma4   , __gs_erfc_8             , __gs_erfc_8             , __gs_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4  , avxfma4   , __gd_erfc_4             , __gd_erfc_4             , __gd_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , avxfma4   , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , avxfma4   , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8m , avxfma4   , __fs_erfc_8_mn          , __rs_erfc_8_mn          , __ps_erfc_8_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4m , avxfma4   , __fd_erfc_4_mn          , __rd_erfc_4_mn          , __pd_erfc_4_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , avx2      , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , avx2      , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , avx2      , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , avx2      , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8  , avx2      , __gs_erfc_8             , __gs_erfc_8             , __gs_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4  , avx2      , __gd_erfc_4             , __gd_erfc_4             , __gd_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , avx2      , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , avx2      , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8m , avx2      , __fs_erfc_8_mn          , __rs_erfc_8_mn          , __ps_erfc_8_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4m , avx2      , __fd_erfc_4_mn          , __rd_erfc_4_mn          , __pd_erfc_4_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , avx512knl , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , avx512knl , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , avx512knl , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , avx512knl , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8  , avx512knl , __gs_erfc_8             , __gs_erfc_8             , __gs_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4  , avx512knl , __gd_erfc_4             , __gd_erfc_4             , __gd_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv16 , avx512knl , __gs_erfc_16            , __gs_erfc_16            , __gs_erfc_16            ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv8  , avx512knl , __gd_erfc_8             , __gd_erfc_8             , __gd_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , avx512knl , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , avx512knl , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8m , avx512knl , __fs_erfc_8_mn          , __rs_erfc_8_mn          , __ps_erfc_8_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4m , avx512knl , __fd_erfc_4_mn          , __rd_erfc_4_mn          , __pd_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv16m, avx512knl , __fs_erfc_16_mn         , __rs_erfc_16_mn         , __ps_erfc_16_mn         ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv8m , avx512knl , __fd_erfc_8_mn          , __rd_erfc_8_mn          , __pd_erfc_8_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc        , ss   , avx512    , __mth_i_erfc            , __mth_i_erfc            , __mth_i_erfc            ,__math_dispatch_error)
+MTHINTRIN(erfc        , ds   , avx512    , __mth_i_derfc           , __mth_i_derfc           , __mth_i_derfc           ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4  , avx512    , __gs_erfc_4             , __gs_erfc_4             , __gs_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2  , avx512    , __gd_erfc_2             , __gd_erfc_2             , __gd_erfc_2             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8  , avx512    , __gs_erfc_8             , __gs_erfc_8             , __gs_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4  , avx512    , __gd_erfc_4             , __gd_erfc_4             , __gd_erfc_4             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv16 , avx512    , __gs_erfc_16            , __gs_erfc_16            , __gs_erfc_16            ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv8  , avx512    , __gd_erfc_8             , __gd_erfc_8             , __gd_erfc_8             ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv4m , avx512    , __fs_erfc_4_mn          , __rs_erfc_4_mn          , __ps_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv2m , avx512    , __fd_erfc_2_mn          , __rd_erfc_2_mn          , __pd_erfc_2_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv8m , avx512    , __fs_erfc_8_mn          , __rs_erfc_8_mn          , __ps_erfc_8_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv4m , avx512    , __fd_erfc_4_mn          , __rd_erfc_4_mn          , __pd_erfc_4_mn          ,__math_dispatch_error)
+MTHINTRIN(erfc        , sv16m, avx512    , __fs_erfc_16_mn         , __rs_erfc_16_mn         , __ps_erfc_16_mn         ,__math_dispatch_error)
+MTHINTRIN(erfc        , dv8m , avx512    , __fd_erfc_8_mn          , __rd_erfc_8_mn          , __pd_erfc_8_mn          ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , em64t     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , em64t     , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , em64t     , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , em64t     , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , em64t     , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , em64t     , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , sse4      , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , sse4      , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , sse4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , sse4      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , sse4      , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , sse4      , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , avx       , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , avx       , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , avx       , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , avx       , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8  , avx       , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4  , avx       , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , avx       , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , avx       , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8m , avx       , __fs_erfc_scaled_8_mn   , __rs_erfc_scaled_8_mn   , __ps_erfc_scaled_8_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4m , avx       , __fd_erfc_scaled_4_mn   , __rd_erfc_scaled_4_mn   , __pd_erfc_scaled_4_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , avxfma4   , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , avxfma4   , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , avxfma4   , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , avxfma4   , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8  , avxfma4   , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4  , avxfma4   , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , avxfma4   , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , avxfma4   , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8m , avxfma4   , __fs_erfc_scaled_8_mn   , __rs_erfc_scaled_8_mn   , __ps_erfc_scaled_8_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4m , avxfma4   , __fd_erfc_scaled_4_mn   , __rd_erfc_scaled_4_mn   , __pd_erfc_scaled_4_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , avx2      , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , avx2      , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , avx2      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , avx2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8  , avx2      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4  , avx2      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , avx2      , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , avx2      , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8m , avx2      , __fs_erfc_scaled_8_mn   , __rs_erfc_scaled_8_mn   , __ps_erfc_scaled_8_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4m , avx2      , __fd_erfc_scaled_4_mn   , __rd_erfc_scaled_4_mn   , __pd_erfc_scaled_4_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , avx512knl , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , avx512knl , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , avx512knl , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , avx512knl , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8  , avx512knl , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4  , avx512knl , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv16 , avx512knl , __gs_erfc_scaled_16     , __gs_erfc_scaled_16     , __gs_erfc_scaled_16     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv8  , avx512knl , __gd_erfc_scaled_8      , __gd_erfc_scaled_8      , __gd_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , avx512knl , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , avx512knl , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8m , avx512knl , __fs_erfc_scaled_8_mn   , __rs_erfc_scaled_8_mn   , __ps_erfc_scaled_8_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4m , avx512knl , __fd_erfc_scaled_4_mn   , __rd_erfc_scaled_4_mn   , __pd_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv16m, avx512knl , __fs_erfc_scaled_16_mn  , __rs_erfc_scaled_16_mn  , __ps_erfc_scaled_16_mn  ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv8m , avx512knl , __fd_erfc_scaled_8_mn   , __rd_erfc_scaled_8_mn   , __pd_erfc_scaled_8_mn   ,__math_dispatch_error)
+
+MTHINTRIN(erfc_scaled , ss   , avx512    , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     , __mth_i_erfc_scaled     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , ds   , avx512    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    , __mth_i_derfc_scaled    ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4  , avx512    , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      , __gs_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2  , avx512    , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      , __gd_erfc_scaled_2      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8  , avx512    , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      , __gs_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4  , avx512    , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      , __gd_erfc_scaled_4      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv16 , avx512    , __gs_erfc_scaled_16     , __gs_erfc_scaled_16     , __gs_erfc_scaled_16     ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv8  , avx512    , __gd_erfc_scaled_8      , __gd_erfc_scaled_8      , __gd_erfc_scaled_8      ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv4m , avx512    , __fs_erfc_scaled_4_mn   , __rs_erfc_scaled_4_mn   , __ps_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv2m , avx512    , __fd_erfc_scaled_2_mn   , __rd_erfc_scaled_2_mn   , __pd_erfc_scaled_2_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv8m , avx512    , __fs_erfc_scaled_8_mn   , __rs_erfc_scaled_8_mn   , __ps_erfc_scaled_8_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv4m , avx512    , __fd_erfc_scaled_4_mn   , __rd_erfc_scaled_4_mn   , __pd_erfc_scaled_4_mn   ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , sv16m, avx512    , __fs_erfc_scaled_16_mn  , __rs_erfc_scaled_16_mn  , __ps_erfc_scaled_16_mn  ,__math_dispatch_error)
+MTHINTRIN(erfc_scaled , dv8m , avx512    , __fd_erfc_scaled_8_mn   , __rd_erfc_scaled_8_mn   , __pd_erfc_scaled_8_mn   ,__math_dispatch_error)
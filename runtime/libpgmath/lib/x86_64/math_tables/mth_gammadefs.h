@@ -0,0 +1,160 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+MTHINTRIN(gamma     , ss   , em64t     , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , em64t     , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , em64t     , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , em64t     , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , em64t     , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , em64t     , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , sse4      , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , sse4      , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , sse4      , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , sse4      , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , sse4      , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , sse4      , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , avx       , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , avx       , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , avx       , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , avx       , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8  , avx       , __gs_gamma_8_f          , __gs_gamma_8_r          , __gs_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4  , avx       , __gd_gamma_4_f          , __gd_gamma_4_r          , __gd_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , avx       , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , avx       , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8m , avx       , __fs_gamma_8_mn         , __rs_gamma_8_mn         , __ps_gamma_8_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4m , avx       , __fd_gamma_4_mn         , __rd_gamma_4_mn         , __pd_gamma_4_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , avxfma4   , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , avxfma4   , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , avxfma4   , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , avxfma4   , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8  , avxfma4   , __gs_gamma_8_f          , __gs_gamma_8_r          , __gs_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4  , avxfma4   , __gd_gamma_4_f          , __gd_gamma_4_r          , __gd_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , avxfma4   , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , avxfma4   , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8m , avxfma4   , __fs_gamma_8_mn         , __rs_gamma_8_mn         , __ps_gamma_8_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4m , avxfma4   , __fd_gamma_4_mn         , __rd_gamma_4_mn         , __pd_gamma_4_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , avx2      , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , avx2      , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , avx2      , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , avx2      , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8  , avx2      , __gs_gamma_8_f          , __gs_gamma_8_r          , __gs_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4  , avx2      , __gd_gamma_4_f          , __gd_gamma_4_r          , __gd_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , avx2      , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , avx2      , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8m , avx2      , __fs_gamma_8_mn         , __rs_gamma_8_mn         , __ps_gamma_8_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4m , avx2      , __fd_gamma_4_mn         , __rd_gamma_4_mn         , __pd_gamma_4_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , avx512knl , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , avx512knl , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , avx512knl , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , avx512knl , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8  , avx512knl , __gs_gamma_8_f          , __gs_gamma_8_r          , __gs_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4  , avx512knl , __gd_gamma_4_f          , __gd_gamma_4_r          , __gd_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv16 , avx512knl , __gs_gamma_16_f         , __gs_gamma_16_r         , __gs_gamma_16_p         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv8  , avx512knl , __gd_gamma_8_f          , __gd_gamma_8_r          , __gd_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , avx512knl , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , avx512knl , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8m , avx512knl , __fs_gamma_8_mn         , __rs_gamma_8_mn         , __ps_gamma_8_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4m , avx512knl , __fd_gamma_4_mn         , __rd_gamma_4_mn         , __pd_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv16m, avx512knl , __fs_gamma_16_mn        , __rs_gamma_16_mn        , __ps_gamma_16_mn        ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv8m , avx512knl , __fd_gamma_8_mn         , __rd_gamma_8_mn         , __pd_gamma_8_mn         ,__math_dispatch_error)
+
+MTHINTRIN(gamma     , ss   , avx512    , __mth_i_gamma           , __mth_i_gamma           , __mth_i_gamma           ,__math_dispatch_error)
+MTHINTRIN(gamma     , ds   , avx512    , __mth_i_dgamma          , __mth_i_dgamma          , __mth_i_dgamma          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4  , avx512    , __gs_gamma_4_f          , __gs_gamma_4_r          , __gs_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2  , avx512    , __gd_gamma_2_f          , __gd_gamma_2_r          , __gd_gamma_2_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8  , avx512    , __gs_gamma_8_f          , __gs_gamma_8_r          , __gs_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4  , avx512    , __gd_gamma_4_f          , __gd_gamma_4_r          , __gd_gamma_4_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv16 , avx512    , __gs_gamma_16_f         , __gs_gamma_16_r         , __gs_gamma_16_p         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv8  , avx512    , __gd_gamma_8_f          , __gd_gamma_8_r          , __gd_gamma_8_p          ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv4m , avx512    , __fs_gamma_4_mn         , __rs_gamma_4_mn         , __ps_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv2m , avx512    , __fd_gamma_2_mn         , __rd_gamma_2_mn         , __pd_gamma_2_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv8m , avx512    , __fs_gamma_8_mn         , __rs_gamma_8_mn         , __ps_gamma_8_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv4m , avx512    , __fd_gamma_4_mn         , __rd_gamma_4_mn         , __pd_gamma_4_mn         ,__math_dispatch_error)
+MTHINTRIN(gamma     , sv16m, avx512    , __fs_gamma_16_mn        , __rs_gamma_16_mn        , __ps_gamma_16_mn        ,__math_dispatch_error)
+MTHINTRIN(gamma     , dv8m , avx512    , __fd_gamma_8_mn         , __rd_gamma_8_mn         , __pd_gamma_8_mn         ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , em64t     , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , em64t     , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , em64t     , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , em64t     , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , em64t     , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , em64t     , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , sse4      , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , sse4      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , sse4      , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , sse4      , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , sse4      , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , sse4      , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , avx       , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , avx       , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , avx       , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , avx       , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8  , avx       , __gs_log_gamma_8_f      , __gs_log_gamma_8_r      , __gs_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4  , avx       , __gd_log_gamma_4_f      , __gd_log_gamma_4_r      , __gd_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , avx       , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , avx       , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8m , avx       , __fs_log_gamma_8_mn     , __rs_log_gamma_8_mn     , __ps_log_gamma_8_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4m , avx       , __fd_log_gamma_4_mn     , __rd_log_gamma_4_mn     , __pd_log_gamma_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , avxfma4   , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , avxfma4   , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , avxfma4   , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , avxfma4   , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8  , avxfma4   , __gs_log_gamma_8_f      , __gs_log_gamma_8_r      , __gs_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4  , avxfma4   , __gd_log_gamma_4_f      , __gd_log_gamma_4_r      , __gd_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , avxfma4   , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , avxfma4   , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8m , avxfma4   , __fs_log_gamma_8_mn     , __rs_log_gamma_8_mn     , __ps_log_gamma_8_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4m , avxfma4   , __fd_log_gamma_4_mn     , __rd_log_gamma_4_mn     , __pd_log_gamma_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , avx2      , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , avx2      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , avx2      , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , avx2      , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8  , avx2      , __gs_log_gamma_8_f      , __gs_log_gamma_8_r      , __gs_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4  , avx2      , __gd_log_gamma_4_f      , __gd_log_gamma_4_r      , __gd_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , avx2      , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , avx2      , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8m , avx2      , __fs_log_gamma_8_mn     , __rs_log_gamma_8_mn     , __ps_log_gamma_8_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4m , avx2      , __fd_log_gamma_4_mn     , __rd_log_gamma_4_mn     , __pd_log_gamma_4_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , avx512knl , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , avx512knl , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , avx512knl , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , avx512knl , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8  , avx512knl , __gs_log_gamma_8_f      , __gs_log_gamma_8_r      , __gs_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4  , avx512knl , __gd_log_gamma_4_f      , __gd_log_gamma_4_r      , __gd_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv16 , avx512knl , __gs_log_gamma_16_f     , __gs_log_gamma_16_r     , __gs_log_gamma_16_p     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv8  , avx512knl , __gd_log_gamma_8_f      , __gd_log_gamma_8_r      , __gd_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , avx512knl , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , avx512knl , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8m , avx512knl , __fs_log_gamma_8_mn     , __rs_log_gamma_8_mn     , __ps_log_gamma_8_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4m , avx512knl , __fd_log_gamma_4_mn     , __rd_log_gamma_4_mn     , __pd_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv16m, avx512knl , __fs_log_gamma_16_mn    , __rs_log_gamma_16_mn    , __ps_log_gamma_16_mn    ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv8m , avx512knl , __fd_log_gamma_8_mn     , __rd_log_gamma_8_mn     , __pd_log_gamma_8_mn     ,__math_dispatch_error)
+
+MTHINTRIN(log_gamma , ss   , avx512    , __mth_i_log_gamma       , __mth_i_log_gamma       , __mth_i_log_gamma       ,__math_dispatch_error)
+MTHINTRIN(log_gamma , ds   , avx512    , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      , __mth_i_dlog_gamma      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4  , avx512    , __gs_log_gamma_4_f      , __gs_log_gamma_4_r      , __gs_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2  , avx512    , __gd_log_gamma_2_f      , __gd_log_gamma_2_r      , __gd_log_gamma_2_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8  , avx512    , __gs_log_gamma_8_f      , __gs_log_gamma_8_r      , __gs_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4  , avx512    , __gd_log_gamma_4_f      , __gd_log_gamma_4_r      , __gd_log_gamma_4_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv16 , avx512    , __gs_log_gamma_16_f     , __gs_log_gamma_16_r     , __gs_log_gamma_16_p     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv8  , avx512    , __gd_log_gamma_8_f      , __gd_log_gamma_8_r      , __gd_log_gamma_8_p      ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv4m , avx512    , __fs_log_gamma_4_mn     , __rs_log_gamma_4_mn     , __ps_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv2m , avx512    , __fd_log_gamma_2_mn     , __rd_log_gamma_2_mn     , __pd_log_gamma_2_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv8m , avx512    , __fs_log_gamma_8_mn     , __rs_log_gamma_8_mn     , __ps_log_gamma_8_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv4m , avx512    , __fd_log_gamma_4_mn     , __rd_log_gamma_4_mn     , __pd_log_gamma_4_mn     ,__math_dispatch_error)
+MTHINTRIN(log_gamma , sv16m, avx512    , __fs_log_gamma_16_mn    , __rs_log_gamma_16_mn    , __ps_log_gamma_16_mn    ,__math_dispatch_error)
+MTHINTRIN(log_gamma , dv8m , avx512    , __fd_log_gamma_8_mn     , __rd_log_gamma_8_mn     , __pd_log_gamma_8_mn     ,__math_dispatch_error)
@@ -0,0 +1,47 @@
+
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=256 && %libpgmath-run
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "pgmath_ulp.h"
+
+int main(int argc, char *argv[])
+{
+  int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+  parseargs(argc, argv);
+#endif
+
+  /* Lane loops over the scalar routines, the results must be identical. */
+  nfails += ULPCHECK(f, bessel_j0, __mth_i_bessel_j0, __mth_i_dbessel_j0, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(f, bessel_j1, __mth_i_bessel_j1, __mth_i_dbessel_j1, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(f, bessel_y0, __mth_i_bessel_y0, __mth_i_dbessel_y0, 0.0, 100.0, 0, 0);
+  nfails += ULPCHECK(f, bessel_y1, __mth_i_bessel_y1, __mth_i_dbessel_y1, 0.0, 100.0, 0, 0);
+  nfails += ULPCHECK(r, bessel_j0, __mth_i_bessel_j0, __mth_i_dbessel_j0, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(r, bessel_j1, __mth_i_bessel_j1, __mth_i_dbessel_j1, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(r, bessel_y0, __mth_i_bessel_y0, __mth_i_dbessel_y0, 0.0, 100.0, 0, 0);
+  nfails += ULPCHECK(r, bessel_y1, __mth_i_bessel_y1, __mth_i_dbessel_y1, 0.0, 100.0, 0, 0);
+  nfails += ULPCHECK(p, bessel_j0, __mth_i_bessel_j0, __mth_i_dbessel_j0, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(p, bessel_j1, __mth_i_bessel_j1, __mth_i_dbessel_j1, -100.0, 100.0, 0, 0);
+  nfails += ULPCHECK(p, bessel_y0, __mth_i_bessel_y0, __mth_i_dbessel_y0, 0.0, 100.0, 0, 0);
+  nfails += ULPCHECK(p, bessel_y1, __mth_i_bessel_y1, __mth_i_dbessel_y1, 0.0, 100.0, 0, 0);
+
+  printf("bessel_8_ulp Test %s\n", nfails ? "Failed" : "Passed");
+  return nfails ? -1 : 0;
+}
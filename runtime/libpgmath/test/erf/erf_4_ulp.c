@@ -0,0 +1,44 @@
+
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=128 && %libpgmath-run
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "pgmath_ulp.h"
+
+int main(int argc, char *argv[])
+{
+  int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+  parseargs(argc, argv);
+#endif
+
+  /* The vector kernels are not the scalar code, allow a few ulp. */
+  nfails += ULPCHECK(f, erf, __mth_i_erf, __mth_i_derf, -6.0, 6.0, 4, 8);
+  nfails += ULPCHECK(f, erfc, __mth_i_erfc, __mth_i_derfc, -6.0, 28.0, 4, 8);
+  nfails += ULPCHECK(f, erfc_scaled, __mth_i_erfc_scaled, __mth_i_derfc_scaled, -30.0, 1e4, 4, 8);
+  nfails += ULPCHECK(r, erf, __mth_i_erf, __mth_i_derf, -6.0, 6.0, 4, 8);
+  nfails += ULPCHECK(r, erfc, __mth_i_erfc, __mth_i_derfc, -6.0, 28.0, 4, 8);
+  nfails += ULPCHECK(r, erfc_scaled, __mth_i_erfc_scaled, __mth_i_derfc_scaled, -30.0, 1e4, 4, 8);
+  nfails += ULPCHECK(p, erf, __mth_i_erf, __mth_i_derf, -6.0, 6.0, 4, 8);
+  nfails += ULPCHECK(p, erfc, __mth_i_erfc, __mth_i_derfc, -6.0, 28.0, 4, 8);
+  nfails += ULPCHECK(p, erfc_scaled, __mth_i_erfc_scaled, __mth_i_derfc_scaled, -30.0, 1e4, 4, 8);
+
+  printf("erf_4_ulp Test %s\n", nfails ? "Failed" : "Passed");
+  return nfails ? -1 : 0;
+}
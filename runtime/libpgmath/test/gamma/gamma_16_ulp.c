@@ -0,0 +1,41 @@
+
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+// RUN: %libpgmath-compile -DMAX_VREG_SIZE=512 && %libpgmath-run
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#if !defined(TARGET_WIN_X8664)
+#include <unistd.h>
+#endif
+
+#include "pgmath_test.h"
+#include "pgmath_ulp.h"
+
+int main(int argc, char *argv[])
+{
+  int nfails = 0;
+
+#if !defined(TARGET_WIN_X8664)
+  parseargs(argc, argv);
+#endif
+
+  /* Lane loops over the scalar routines, the results must be identical. */
+  nfails += ULPCHECK(f, gamma, __mth_i_gamma, __mth_i_dgamma, -20.0, 40.0, 0, 0);
+  nfails += ULPCHECK(f, log_gamma, __mth_i_log_gamma, __mth_i_dlog_gamma, -20.0, 1e4, 0, 0);
+  nfails += ULPCHECK(r, gamma, __mth_i_gamma, __mth_i_dgamma, -20.0, 40.0, 0, 0);
+  nfails += ULPCHECK(r, log_gamma, __mth_i_log_gamma, __mth_i_dlog_gamma, -20.0, 1e4, 0, 0);
+  nfails += ULPCHECK(p, gamma, __mth_i_gamma, __mth_i_dgamma, -20.0, 40.0, 0, 0);
+  nfails += ULPCHECK(p, log_gamma, __mth_i_log_gamma, __mth_i_dlog_gamma, -20.0, 1e4, 0, 0);
+
+  printf("gamma_16_ulp Test %s\n", nfails ? "Failed" : "Passed");
+  return nfails ? -1 : 0;
+}
@@ -11,16 +11,12 @@
  * Real.
  */
 
-sypedef double  vrd1_t;
-at (*fptr)(float);
-  fptr = (float(*)(float))MTH_DISPATCH_TBL[func_tan][sv_ss][frp_p];
-    return __ZGVxN4v__mth_i_vr4( x, fptr);
-    }
+typedef double  vrd1_t;
 typedef double  vrd2_t  __attribute__((vector_size(2*sizeof(double))));
 typedef double  vrd4_t  __attribute__((vector_size(4*sizeof(double))));
-typede double  vrd8_t  __attribute__((vector_size(8*sizeof(double))));
+typedef double  vrd8_t  __attribute__((vector_size(8*sizeof(double))));
 typedef	float	vrs1_t;
-tnypedef	float	vrs4_t	__attribute__((vector_size(4*sizeof(float))));
+typedef	float	vrs4_t	__attribute__((vector_size(4*sizeof(float))));
 typedef	float	vrs8_t	__attribute__((vector_size(8*sizeof(float))));
 typedef	float	vrs16_t	__attribute__((vector_size(16*sizeof(float))));
 
@@ -230,6 +226,15 @@ EXTERN_EFUNC(sin);
 EXTERN_EFUNC(sinh);
 EXTERN_EFUNC(tan);
 EXTERN_EFUNC(tanh);
+EXTERN_EFUNC(erf);
+EXTERN_EFUNC(erfc);
+EXTERN_EFUNC(erfc_scaled);
+EXTERN_EFUNC(gamma);
+EXTERN_EFUNC(log_gamma);
+EXTERN_EFUNC(bessel_j0);
+EXTERN_EFUNC(bessel_j1);
+EXTERN_EFUNC(bessel_y0);
+EXTERN_EFUNC(bessel_y1);
 
 EXTERN_EFUNC2(atan2);
 EXTERN_EFUNC2(mod);
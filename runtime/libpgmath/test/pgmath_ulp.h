@@ -0,0 +1,156 @@
+
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/*
+ * Compare a vector entry point and its masked form against the scalar
+ * __mth_i_* routine lane by lane and report the largest difference in
+ * units in the last place.  Include after pgmath_test.h.
+ *
+ * ULPCHECK(frp, func, sref, dref, lo, hi, stol, dtol) checks
+ * __<frp>s_<func>_<VLS>{,m} against sref and __<frp>d_<func>_<VLD>{,m}
+ * against dref for arguments spread over [lo, hi] plus a few special
+ * values.
+ */
+
+#define NULPTESTS 20000
+
+float __mth_i_erf(float), __mth_i_erfc(float), __mth_i_erfc_scaled(float);
+float __mth_i_gamma(float), __mth_i_log_gamma(float);
+float __mth_i_bessel_j0(float), __mth_i_bessel_j1(float);
+float __mth_i_bessel_y0(float), __mth_i_bessel_y1(float);
+double __mth_i_derf(double), __mth_i_derfc(double), __mth_i_derfc_scaled(double);
+double __mth_i_dgamma(double), __mth_i_dlog_gamma(double);
+double __mth_i_dbessel_j0(double), __mth_i_dbessel_j1(double);
+double __mth_i_dbessel_y0(double), __mth_i_dbessel_y1(double);
+
+static const double ulp_specials[] = {0.0, -0.0, 1.0, -1.0, 0.5, 1e-30,
+                                      INFINITY, -INFINITY, NAN};
+
+static uint64_t ulp_seed = 88172645463325252ULL;
+
+/* Uniform in [lo, hi], reproducible from run to run. */
+static double
+ulp_random(double lo, double hi)
+{
+  ulp_seed ^= ulp_seed << 13;
+  ulp_seed ^= ulp_seed >> 7;
+  ulp_seed ^= ulp_seed << 17;
+  return lo + (hi - lo) * ((ulp_seed >> 11) * 0x1.0p-53);
+}
+
+/* Map the bits of x onto a line where adjacent floats differ by one. */
+static int64_t
+ulp_ordinal_s(float x)
+{
+  int32_t i;
+
+  memcpy(&i, &x, sizeof i);
+  return i < 0 ? (int64_t)INT32_MIN - i : i;
+}
+
+static int64_t
+ulp_ordinal_d(double x)
+{
+  int64_t i;
+
+  memcpy(&i, &x, sizeof i);
+  return i < 0 ? INT64_MIN - i : i;
+}
+
+static double
+ulp_diff_s(float res, float exp)
+{
+  if (isnan(res) || isnan(exp))
+    return isnan(res) && isnan(exp) ? 0.0 : INFINITY;
+  return fabs((double)(ulp_ordinal_s(res) - ulp_ordinal_s(exp)));
+}
+
+static double
+ulp_diff_d(double res, double exp)
+{
+  int64_t a, b;
+
+  if (isnan(res) || isnan(exp))
+    return isnan(res) && isnan(exp) ? 0.0 : INFINITY;
+  a = ulp_ordinal_d(res);
+  b = ulp_ordinal_d(exp);
+  return a > b ? (double)((uint64_t)a - b) : (double)((uint64_t)b - a);
+}
+
+static int
+ulp_check_s(const char *fname, VRS_T (*vf)(VRS_T), VRS_T (*vfm)(VRS_T, VIS_T),
+            float (*sf)(float), double lo, double hi, double tol)
+{
+  VRS_T x, r, rm;
+  VIS_T m;
+  double d, worst = 0, worstm = 0;
+  float wx = 0, wxm = 0;
+  int n, i, k = 0;
+
+  for (n = 0; n < NULPTESTS / VLS; n++) {
+    for (i = 0; i < VLS; i++, k++) {
+      x[i] = k < sizeof ulp_specials / sizeof *ulp_specials
+                 ? ulp_specials[k] : ulp_random(lo, hi);
+      m[i] = ((n + i) % 3) ? -1 : 0;
+    }
+    r = vf(x);
+    rm = vfm(x, m);
+    for (i = 0; i < VLS; i++) {
+      d = ulp_diff_s(r[i], sf(x[i]));
+      if (d > worst)
+        worst = d, wx = x[i];
+      if (m[i] && (d = ulp_diff_s(rm[i], sf(x[i]))) > worstm)
+        worstm = d, wxm = x[i];
+    }
+  }
+  if (verbose || worst > tol)
+    printf("%s max %g ulp at %.9g\n", fname, worst, wx);
+  if (verbose || worstm > tol)
+    printf("%sm max %g ulp at %.9g\n", fname, worstm, wxm);
+  return (worst > tol) + (worstm > tol);
+}
+
+static int
+ulp_check_d(const char *fname, VRD_T (*vf)(VRD_T), VRD_T (*vfm)(VRD_T, VID_T),
+            double (*sf)(double), double lo, double hi, double tol)
+{
+  VRD_T x, r, rm;
+  VID_T m;
+  double d, worst = 0, worstm = 0, wx = 0, wxm = 0;
+  int n, i, k = 0;
+
+  for (n = 0; n < NULPTESTS / VLD; n++) {
+    for (i = 0; i < VLD; i++, k++) {
+      x[i] = k < sizeof ulp_specials / sizeof *ulp_specials
+                 ? ulp_specials[k] : ulp_random(lo, hi);
+      m[i] = ((n + i) % 3) ? -1 : 0;
+    }
+    r = vf(x);
+    rm = vfm(x, m);
+    for (i = 0; i < VLD; i++) {
+      d = ulp_diff_d(r[i], sf(x[i]));
+      if (d > worst)
+        worst = d, wx = x[i];
+      if (m[i] && (d = ulp_diff_d(rm[i], sf(x[i]))) > worstm)
+        worstm = d, wxm = x[i];
+    }
+  }
+  if (verbose || worst > tol)
+    printf("%s max %g ulp at %.17g\n", fname, worst, wx);
+  if (verbose || worstm > tol)
+    printf("%sm max %g ulp at %.17g\n", fname, worstm, wxm);
+  return (worst > tol) + (worstm > tol);
+}
+
+#define ULPCHECK(frp, func, sref, dref, lo, hi, stol, dtol)                   \
+  (ulp_check_s(STRINGIFY(CONCAT6(__, frp, s_, func, _, VLS)),                 \
+               CONCAT6(__, frp, s_, func, _, VLS),                            \
+               CONCAT7(__, frp, s_, func, _, VLS, m), sref, lo, hi, stol) +   \
+   ulp_check_d(STRINGIFY(CONCAT6(__, frp, d_, func, _, VLD)),                 \
+               CONCAT6(__, frp, d_, func, _, VLD),                            \
+               CONCAT7(__, frp, d_, func, _, VLD, m), dref, lo, hi, dtol))
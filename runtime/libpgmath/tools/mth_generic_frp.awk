@@ -151,6 +151,16 @@ function do_all_rr()
       func_rr_def("ceil", frp, sd, one_arg)
       func_rr_def("floor", frp, sd, one_arg)
       func_rr_def("cotan", frp, sd, one_arg)
+      if (sd == "c" || sd == "z") { continue; } # Real only
+      func_rr_def("erf", frp, sd, one_arg)
+      func_rr_def("erfc", frp, sd, one_arg)
+      func_rr_def("erfc_scaled", frp, sd, one_arg)
+      func_rr_def("gamma", frp, sd, one_arg)
+      func_rr_def("log_gamma", frp, sd, one_arg)
+      func_rr_def("bessel_j0", frp, sd, one_arg)
+      func_rr_def("bessel_j1", frp, sd, one_arg)
+      func_rr_def("bessel_y0", frp, sd, one_arg)
+      func_rr_def("bessel_y1", frp, sd, one_arg)
     }
   }
 }
@@ -399,6 +399,15 @@ BEGIN {
   do_all_rr("ceil", 0, one_arg)
   do_all_rr("floor", 0, one_arg)
   do_all_rr("cotan", 0, one_arg)
+  do_all_rr("erf", 0, one_arg)
+  do_all_rr("erfc", 0, one_arg)
+  do_all_rr("erfc_scaled", 0, one_arg)
+  do_all_rr("gamma", 1, one_arg)
+  do_all_rr("log_gamma", 1, one_arg)
+  do_all_rr("bessel_j0", 0, one_arg)
+  do_all_rr("bessel_j1", 0, one_arg)
+  do_all_rr("bessel_y0", 1, one_arg)
+  do_all_rr("bessel_y1", 1, one_arg)
 
   do_all_pow_r2i()
 }
@@ -646,6 +646,20 @@ __kmpc_barrier_(ident_t *id, kmp_int32 *tn)
 {
 }
 
+kmp_int32
+__kmpc_reduce_nowait(ident_t *loc, kmp_int32 tn, kmp_int32 nvars,
+                     size_t size, void *data, void (*func)(void *, void *),
+                     kmp_critical_name *sem)
+{
+  /* a single thread combines its own copy */
+  return 1;
+}
+
+void
+__kmpc_end_reduce_nowait(ident_t *loc, kmp_int32 tn, kmp_critical_name *sem)
+{
+}
+
 void *
 __kmpc_threadprivate(ident_t *id, kmp_int32 tn, void *data, size_t size)
 {
@@ -0,0 +1,38 @@
+!
+! Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+! See https://llvm.org/LICENSE.txt for license information.
+! SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+!
+
+! The preprocessor skips a second inclusion of a header whose whole text is
+! guarded by #ifndef, but includes it again once the guard is #undef'd, and
+! never skips a header with code after its #endif.  Skipped headers are still
+! listed as dependencies.
+
+! RUN: rm -rf %t && mkdir -p %t
+! RUN: printf '#ifndef GUARD_H\n#define GUARD_H\n  call guarded()\n#endif\n' > %t/guard.h
+! RUN: printf '#ifndef TRAIL_H\n#define TRAIL_H\n#endif\n  call trailing()\n' > %t/trail.h
+! RUN: %flang -E -cpp -I%t %s | FileCheck %s --match-full-lines
+! RUN: %flang -E -cpp -Hx,123,2 -I%t %s | FileCheck %s --check-prefix=DEPS
+
+! CHECK: call guarded()
+! CHECK-NOT: call guarded()
+! CHECK: call after_twice()
+! CHECK: call guarded()
+! CHECK: call after_undef()
+! CHECK: call trailing()
+! CHECK: call trailing()
+! CHECK: end subroutine
+
+! DEPS: {{.*}}.o : {{.*}}fpp_include_guard.f90 {{.*}}guard.h {{.*}}trail.h
+
+subroutine s
+#include "guard.h"
+#include "guard.h"
+  call after_twice()
+#undef GUARD_H
+#include "guard.h"
+  call after_undef()
+#include "trail.h"
+#include "trail.h"
+end subroutine
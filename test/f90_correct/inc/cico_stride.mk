@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test cico_stride  ########
+
+
+cico_stride: run
+	
+
+build:  $(SRC)/cico_stride.f90
+	-$(RM) cico_stride.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/cico_stride.f90 -o cico_stride.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) cico_stride.$(OBJX) check.$(OBJX) $(LIBS) -o cico_stride.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test cico_stride
+	cico_stride.$(EXESUFFIX)
+
+verify: ;
+
+cico_stride.run: run
+
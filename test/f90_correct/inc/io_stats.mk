@@ -0,0 +1,45 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test io_stats  ########
+
+
+io_stats: run
+	
+
+build:  $(SRC)/io_stats.f90
+	-$(RM) io_stats.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/io_stats.f90 -o io_stats.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) io_stats.$(OBJX) check.$(OBJX) $(LIBS) -o io_stats.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test io_stats
+	FLANG_IO_STATS=1 FLANG_IO_TRACE=io_stats.json io_stats.$(EXESUFFIX) > io_stats.log 2> io_stats.err
+
+# The trace must show the five direct access writes as one 400 byte record
+# each, the two sequential writes with their record markers, and a seek for
+# each REWIND; the table must have the unit totals and the internal file and
+# format rows.  The test's own result is only shown if they all hold.
+verify:
+	@echo ------------------------------------ verifying test io_stats
+	@if [ `grep -c '"unit":13,"stmt":"unformatted write",.*"wbytes":400,"records":1,' io_stats.json` -eq 5 ] && \
+	    [ `grep -c '"unit":12,"stmt":"unformatted write",.*"wbytes":408,"records":1,' io_stats.json` -eq 2 ] && \
+	    [ `grep -c '"stmt":"REWIND",.*"seeks":1}' io_stats.json` -eq 3 ] && \
+	    [ "`awk '$$1 == 13 { print $$3, $$5 }' io_stats.err`" = "6 2000" ] && \
+	    [ "`awk '$$1 == 12 { print $$5 }' io_stats.err`" = "816" ] && \
+	    grep -q ' (formats)$$' io_stats.err && \
+	    grep -q ' (internal)$$' io_stats.err; then \
+	  cat io_stats.log; \
+	else \
+	  cat io_stats.err; \
+	  echo "RESULT: FAIL"; \
+	fi
+
+io_stats.run: run
+
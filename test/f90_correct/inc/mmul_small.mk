@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test mmul_small  ########
+
+
+mmul_small: run
+	
+
+build:  $(SRC)/mmul_small.f90
+	-$(RM) mmul_small.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/mmul_small.f90 -o mmul_small.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) mmul_small.$(OBJX) check.$(OBJX) $(LIBS) -o mmul_small.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test mmul_small
+	mmul_small.$(EXESUFFIX)
+
+verify: ;
+
+mmul_small.run: run
+
@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test nml_index  ########
+
+
+nml_index: run
+	
+
+build:  $(SRC)/nml_index.f90
+	-$(RM) nml_index.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/nml_index.f90 -o nml_index.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) nml_index.$(OBJX) check.$(OBJX) $(LIBS) -o nml_index.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test nml_index
+	nml_index.$(EXESUFFIX)
+
+verify: ;
+
+nml_index.run: run
+
@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test ovlp_asn  ########
+
+
+ovlp_asn: run
+	
+
+build:  $(SRC)/ovlp_asn.f90
+	-$(RM) ovlp_asn.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/ovlp_asn.f90 -o ovlp_asn.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) ovlp_asn.$(OBJX) check.$(OBJX) $(LIBS) -o ovlp_asn.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test ovlp_asn
+	ovlp_asn.$(EXESUFFIX)
+
+verify: ;
+
+ovlp_asn.run: run
+
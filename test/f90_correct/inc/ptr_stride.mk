@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test ptr_stride  ########
+
+
+ptr_stride: run
+	
+
+build:  $(SRC)/ptr_stride.f90
+	-$(RM) ptr_stride.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/ptr_stride.f90 -o ptr_stride.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) ptr_stride.$(OBJX) check.$(OBJX) $(LIBS) -o ptr_stride.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test ptr_stride
+	ptr_stride.$(EXESUFFIX)
+
+verify: ;
+
+ptr_stride.run: run
+
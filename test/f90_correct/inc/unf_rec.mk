@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test unf_rec  ########
+
+
+unf_rec: run
+	
+
+build:  $(SRC)/unf_rec.f90
+	-$(RM) unf_rec.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/unf_rec.f90 -o unf_rec.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) unf_rec.$(OBJX) check.$(OBJX) $(LIBS) -o unf_rec.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test unf_rec
+	unf_rec.$(EXESUFFIX)
+
+verify: ;
+
+unf_rec.run: run
+
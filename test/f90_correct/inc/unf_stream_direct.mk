@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test unf_stream_direct  ########
+
+
+unf_stream_direct: run
+	
+
+build:  $(SRC)/unf_stream_direct.f90
+	-$(RM) unf_stream_direct.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/unf_stream_direct.f90 -o unf_stream_direct.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) unf_stream_direct.$(OBJX) check.$(OBJX) $(LIBS) -o unf_stream_direct.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test unf_stream_direct
+	FORTRANOPT=stream_direct unf_stream_direct.$(EXESUFFIX)
+
+verify: ;
+
+unf_stream_direct.run: run
+
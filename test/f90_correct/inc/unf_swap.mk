@@ -0,0 +1,28 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+########## Make rule for test unf_swap  ########
+
+
+unf_swap: run
+	
+
+build:  $(SRC)/unf_swap.f90
+	-$(RM) unf_swap.$(EXESUFFIX) core *.d *.mod FOR*.DAT FTN* ftn* fort.*
+	@echo ------------------------------------ building test $@
+	-$(CC) -c $(CFLAGS) $(SRC)/check.c -o check.$(OBJX)
+	-$(FC) -c $(FFLAGS) $(LDFLAGS) $(SRC)/unf_swap.f90 -o unf_swap.$(OBJX)
+	-$(FC) $(FFLAGS) $(LDFLAGS) unf_swap.$(OBJX) check.$(OBJX) $(LIBS) -o unf_swap.$(EXESUFFIX)
+
+
+run:
+	@echo ------------------------------------ executing test unf_swap
+	unf_swap.$(EXESUFFIX)
+
+verify: ;
+
+unf_swap.run: run
+
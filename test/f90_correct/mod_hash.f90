@@ -0,0 +1,64 @@
+!
+! Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+! See https://llvm.org/LICENSE.txt for license information.
+! SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+!
+
+! A .mod file whose interface hash is unchanged keeps its time stamp, even
+! when lines are added to a module procedure or the source is renamed; a
+! changed interface, or -Hx,55,1, rewrites it with the new hash.
+
+! RUN: rm -rf %t && mkdir -p %t
+! RUN: %flang -c -cpp -module %t %s -o %t/mod_hash.o
+! RUN: sed -n 2p %t/mod_hash_m.mod | FileCheck %s
+! RUN: sed -n 2p %t/mod_hash_m.mod > %t/hash1
+
+! Recompiling the same source leaves the .mod alone.
+! RUN: touch -t 200001010000 %t/mod_hash_m.mod %t/old
+! RUN: %flang -c -cpp -module %t %s -o %t/mod_hash.o
+! RUN: test ! %t/mod_hash_m.mod -nt %t/old
+! RUN: ls %t | FileCheck %s --check-prefix=NOTMP
+
+! Lines added to the body of s move t, but t's interface is the same.
+! RUN: %flang -c -cpp -DLONGER -module %t %s -o %t/mod_hash.o
+! RUN: test ! %t/mod_hash_m.mod -nt %t/old
+! RUN: cp %s %t/mod_hash_copy.f90
+! RUN: %flang -c -cpp -module %t %t/mod_hash_copy.f90 -o %t/mod_hash.o
+! RUN: test ! %t/mod_hash_m.mod -nt %t/old
+
+! -Hx,55,1 rewrites it anyway, with the same hash.
+! RUN: %flang -c -cpp -Hx,55,1 -module %t %s -o %t/mod_hash.o
+! RUN: test %t/mod_hash_m.mod -nt %t/old
+! RUN: sed -n 2p %t/mod_hash_m.mod | diff - %t/hash1
+
+! A new public variable changes the hash.
+! RUN: touch -t 200001010000 %t/mod_hash_m.mod
+! RUN: %flang -c -cpp -DCHANGED -module %t %s -o %t/mod_hash.o
+! RUN: test %t/mod_hash_m.mod -nt %t/old
+! RUN: sed -n 2p %t/mod_hash_m.mod | FileCheck %s
+! RUN: sed -n 2p %t/mod_hash_m.mod | not diff - %t/hash1
+! RUN: ls %t | FileCheck %s --check-prefix=NOTMP
+
+! CHECK: mod_hash.f90 {{.*}} H{{[0-9a-f]{16}$}}
+! NOTMP-NOT: .tmp
+
+module mod_hash_m
+  integer :: a = 1
+#ifdef CHANGED
+  integer :: b = 2
+#endif
+contains
+  subroutine s(x)
+    integer :: x
+#ifdef LONGER
+    x = 0
+
+    x = x + 1
+#endif
+    x = a
+  end subroutine
+  subroutine t(y)
+    real :: y
+    y = a
+  end subroutine
+end module
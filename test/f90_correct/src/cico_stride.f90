@@ -0,0 +1,260 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for array sections with a stride known only at run time passed to
+!* explicit-shape dummies.  When the strides are 1 the section is passed in
+!* place, otherwise it is copied in and out of a temp.
+
+subroutine bump(b, n, k)
+  integer :: n, k
+  integer :: b(n)
+  integer :: i
+  do i = 1, n
+    b(i) = b(i) + k * i
+  enddo
+end subroutine
+
+subroutine bumps(b, n, s)
+  integer :: n, s
+  integer :: b(n)
+  integer :: i
+  do i = 1, n
+    b(i) = b(i) + 1000 * i
+  enddo
+  s = 3
+end subroutine
+
+subroutine total(b, n, r)
+  integer :: n, r
+  integer, intent(in) :: b(n)
+  r = sum(b)
+end subroutine
+
+subroutine at(b, a)
+  integer :: b(*)
+  integer(8) :: a
+  a = loc(b)
+end subroutine
+
+subroutine bumpc(b, n)
+  integer :: n
+  character(len=2) :: b(n)
+  integer :: i
+  do i = 1, n
+    b(i)(2:2) = achar(iachar('a') + i)
+  enddo
+end subroutine
+
+program p
+  parameter(NbrTests=28)
+  parameter(n=12, m=4)
+
+  interface
+    subroutine bump(b, n, k)
+      integer :: n, k
+      integer :: b(n)
+    end subroutine
+    subroutine bumps(b, n, s)
+      integer :: n, s
+      integer :: b(n)
+    end subroutine
+    subroutine total(b, n, r)
+      integer :: n, r
+      integer, intent(in) :: b(n)
+    end subroutine
+    subroutine at(b, a)
+      integer :: b(*)
+      integer(8) :: a
+    end subroutine
+    subroutine bumpc(b, n)
+      integer :: n
+      character(len=2) :: b(n)
+    end subroutine
+  end interface
+
+  integer :: x(n), y(n), u(n,m), v(n,m)
+  integer, allocatable :: z(:)
+  character(len=2) :: c(n), d(n)
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: i, j, s, s2, r, nr, ne
+  integer(8) :: a
+
+  nr = 0
+  ne = 0
+
+  ! stride 1 at run time: passed in place
+  s = 1
+  call init
+  call bump(x(3:8:s), 6, 1)
+  do i = 3, 8
+    y(i) = y(i) + (i - 2)
+  enddo
+  call put(x, y, n)
+  call at(x(3:8:s), a)
+  call put1(merge(1, 0, a == loc(x(3))), 1)
+
+  ! stride 2: copied in and out
+  s = 2
+  call init
+  call bump(x(2:11:s), 5, 1)
+  do i = 1, 5
+    y(2*i) = y(2*i) + i
+  enddo
+  call put(x, y, n)
+
+  ! negative stride
+  s = -1
+  call init
+  call bump(x(n:1:s), n, 1)
+  do i = 1, n
+    y(n+1-i) = y(n+1-i) + i
+  enddo
+  call put(x, y, n)
+
+  ! whole leading dimension, variable stride in the trailing one
+  s = 1
+  call init2
+  call bump(u(:,2:3:s), 2*n, 1)
+  do j = 2, 3
+    do i = 1, n
+      v(i,j) = v(i,j) + (j - 2) * n + i
+    enddo
+  enddo
+  call put2
+  call at(u(:,2:3:s), a)
+  call put1(merge(1, 0, a == loc(u(1,2))), 1)
+
+  s = 2
+  call init2
+  call bump(u(:,1:4:s), 2*n, 1)
+  do j = 1, 3, 2
+    do i = 1, n
+      v(i,j) = v(i,j) + (j / 2) * n + i
+    enddo
+  enddo
+  call put2
+
+  ! partial leading dimension: always copied
+  s = 1
+  call init2
+  call bump(u(2:4,1:2:s), 6, 1)
+  do j = 1, 2
+    do i = 2, 4
+      v(i,j) = v(i,j) + (j - 1) * 3 + i - 1
+    enddo
+  enddo
+  call put2
+
+  ! variable strides in both dimensions
+  s = 1
+  s2 = 1
+  call init2
+  call bump(u(1:n:s,2:4:s2), 3*n, 2)
+  do j = 2, 4
+    do i = 1, n
+      v(i,j) = v(i,j) + 2 * ((j - 2) * n + i)
+    enddo
+  enddo
+  call put2
+
+  s2 = 2
+  call init2
+  call bump(u(1:n:s,2:4:s2), 2*n, 2)
+  do j = 2, 4, 2
+    do i = 1, n
+      v(i,j) = v(i,j) + 2 * ((j / 2 - 1) * n + i)
+    enddo
+  enddo
+  call put2
+
+  ! the callee changes the stride variable
+  s = 1
+  call init
+  call bumps(x(1:6:s), 6, s)
+  do i = 1, 6
+    y(i) = y(i) + 1000 * i
+  enddo
+  call put(x, y, n)
+  call put1(s, 3)
+
+  ! intent(in) dummy
+  s = 2
+  call init
+  call total(x(1:n:s), n/2, r)
+  call put1(r, sum(y(1:n:2)))
+  call put(x, y, n)
+
+  ! allocatable array
+  allocate(z(n))
+  z = (/ (i, i=1,n) /)
+  y = z
+  s = 1
+  call bump(z(4:n:s), n-3, 1)
+  do i = 4, n
+    y(i) = y(i) + i - 3
+  enddo
+  call put(z, y, n)
+  call at(z(4:n:s), a)
+  call put1(merge(1, 0, a == loc(z(4))), 1)
+
+  ! character array
+  c = 'xx'
+  d = 'xx'
+  s = 1
+  call bumpc(c(2:5:s), 4)
+  do i = 1, 4
+    d(i+1)(2:2) = achar(iachar('a') + i)
+  enddo
+  s = 3
+  call bumpc(c(1:n:s), 4)
+  do i = 1, 4
+    d(3*i-2)(2:2) = achar(iachar('a') + i)
+  enddo
+  do i = 1, n
+    call put1(iachar(c(i)(2:2)), iachar(d(i)(2:2)))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine init
+    x = (/ (i, i=1,n) /)
+    y = x
+  end subroutine
+
+  subroutine init2
+    do j = 1, m
+      do i = 1, n
+        u(i,j) = i + 100 * j
+      enddo
+    enddo
+    v = u
+  end subroutine
+
+  subroutine put(xx, yy, nn)
+    integer :: nn
+    integer :: xx(nn), yy(nn)
+    integer :: k
+    k = 0
+    do i = 1, nn
+      if (xx(i) .ne. yy(i)) k = k + 1
+    enddo
+    call put1(k, 0)
+  end subroutine
+
+  subroutine put2
+    call put1(count(u .ne. v), 0)
+  end subroutine
+
+  subroutine put1(r1, e1)
+    integer :: r1, e1
+    nr = nr + 1
+    ne = ne + 1
+    results(nr) = r1
+    expect(ne) = e1
+  end subroutine
+
+end program
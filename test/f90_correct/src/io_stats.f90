@@ -0,0 +1,113 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests that i/o gives the same results when it is being counted and
+!* traced, run with FLANG_IO_STATS and FLANG_IO_TRACE set: formatted,
+!* list-directed and namelist i/o, unformatted sequential, direct and stream
+!* access, internal files, i/o in a function referenced in an i/o list,
+!* statements ending with an error or end of file, and repositioning.
+
+program p
+  parameter(NbrTests=10)
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: a(100), b(100), i, k, nr, ios
+  real :: r
+  character(len=20) :: s
+  namelist /nl/ k, r
+
+  nr = 0
+  expect = 0
+  results = 0
+  a = (/ (i * 7, i = 1, 100) /)
+
+  open(10, file='io_stats.txt', status='replace')
+  do i = 1, 10
+    write(10, '(i6, f10.2)') i, i * 1.5
+  enddo
+  write(10, *) f(3), 'x'
+  rewind(10)
+  ios = 0
+  do i = 1, 10
+    read(10, *) k, r
+    ios = ios + abs(k - i) + merge(0, 1, r == i * 1.5)
+  enddo
+  nr = nr + 1
+  results(nr) = ios
+  read(10, '(a)') s
+  nr = nr + 1
+  results(nr) = merge(0, 1, adjustl(s) == '30 x')
+  read(10, *, iostat=ios) k
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios < 0)
+  close(10, status='delete')
+
+  open(11, file='io_stats.nml', status='replace')
+  k = 5
+  r = 2.5
+  write(11, nml=nl)
+  k = 0
+  r = 0
+  rewind(11)
+  read(11, nml=nl)
+  close(11, status='delete')
+  nr = nr + 1
+  results(nr) = abs(k - 5) + merge(0, 1, r == 2.5)
+
+  open(12, file='io_stats.seq', form='unformatted', status='replace')
+  write(12) a
+  write(12) a(100:1:-1)
+  rewind(12)
+  read(12)
+  b = 0
+  read(12) b
+  close(12, status='delete')
+  nr = nr + 1
+  results(nr) = count(b /= a(100:1:-1))
+
+  open(13, file='io_stats.dir', form='unformatted', access='direct', &
+       recl=400, status='replace')
+  do i = 1, 5
+    write(13, rec=i) a + i
+  enddo
+  b = 0
+  read(13, rec=3) b
+  nr = nr + 1
+  results(nr) = count(b /= a + 3)
+  read(13, rec=9, iostat=ios) b
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  close(13, status='delete')
+
+  open(14, file='io_stats.str', form='unformatted', access='stream', &
+       status='replace')
+  write(14) a
+  b = 0
+  read(14, pos=41) b(1:10)
+  close(14, status='delete')
+  nr = nr + 1
+  results(nr) = count(b(1:10) /= a(11:20))
+
+  write(s, '(i4, a)') f(4), 'y'
+  nr = nr + 1
+  results(nr) = merge(0, 1, s == '  40y')
+
+  open(15, file='io_stats_none.txt', status='old', iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  integer function f(n)
+    integer :: n
+    character(len=8) :: t
+
+    write(t, '(i8)') n * 10
+    read(t, *) f
+  end function
+
+end program
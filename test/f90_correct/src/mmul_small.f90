@@ -0,0 +1,159 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for MATMUL, DOT_PRODUCT and TRANSPOSE of small constant shape,
+!* which the compiler expands inline
+
+program p
+  parameter(NbrTests=99)
+
+  real*8 :: a(3,3), b(3,3), c(3,3), a0(3,3)
+  real*8 :: d(4,4), e(4,4), f(4,4), d0(4,4)
+  real*8 :: v(3), w(3), v0(3), x(3,2), s
+  integer :: ia(4), is
+  integer*8 :: ib(4)
+  logical :: l1(3), l2(3), ls
+  real*8 :: expect(NbrTests)
+  real*8 :: results(NbrTests)
+  integer :: i, j, k, n
+
+  do j = 1, 3
+    do i = 1, 3
+      a(i,j) = i + 3 * j - 3
+      b(i,j) = 2 * (i + 3 * j) - 9
+    enddo
+    v(j) = j - 0.5
+  enddo
+  do j = 1, 4
+    do i = 1, 4
+      d(i,j) = mod(i + 4 * j, 5)
+      e(i,j) = i + 4 * j - 12
+    enddo
+  enddo
+  ia = (/ 1, -2, 3, 4 /)
+  ib = (/ 5, 6, -7, 8 /)
+  l1 = (/ .false., .true., .false. /)
+  l2 = (/ .true., .true., .false. /)
+  a0 = a
+  d0 = d
+  v0 = v
+
+  n = 0
+  ! mxm, mxm with either operand transposed, mxv and vxm
+  c = matmul(a, b)
+  do j = 1, 3
+    do i = 1, 3
+      n = n + 1
+      results(n) = c(i,j)
+      expect(n) = sum(a(i,:) * b(:,j))
+    enddo
+  enddo
+  c = matmul(transpose(a), b)
+  do j = 1, 3
+    do i = 1, 3
+      n = n + 1
+      results(n) = c(i,j)
+      expect(n) = sum(a(:,i) * b(:,j))
+    enddo
+  enddo
+  c = matmul(a, transpose(b))
+  do j = 1, 3
+    do i = 1, 3
+      n = n + 1
+      results(n) = c(i,j)
+      expect(n) = sum(a(i,:) * b(j,:))
+    enddo
+  enddo
+  f = matmul(d, e)
+  do j = 1, 4
+    do i = 1, 4
+      n = n + 1
+      results(n) = f(i,j)
+      expect(n) = sum(d(i,:) * e(:,j))
+    enddo
+  enddo
+  w = matmul(a, v)
+  do i = 1, 3
+    n = n + 1
+    results(n) = w(i)
+    expect(n) = sum(a(i,:) * v)
+  enddo
+  w = matmul(v, b)
+  do i = 1, 3
+    n = n + 1
+    results(n) = w(i)
+    expect(n) = sum(v * b(:,i))
+  enddo
+  w = matmul(transpose(a), v)
+  do i = 1, 3
+    n = n + 1
+    results(n) = w(i)
+    expect(n) = sum(a(:,i) * v)
+  enddo
+
+  ! sections
+  x = 0
+  x(:, 1:2) = matmul(a(:, 2:3), b(2:3, 1:2))
+  do j = 1, 2
+    do i = 1, 3
+      n = n + 1
+      results(n) = x(i,j)
+      expect(n) = sum(a(i,2:3) * b(2:3,j))
+    enddo
+  enddo
+
+  ! result overlaps an operand
+  a = matmul(a, b)
+  do j = 1, 3
+    do i = 1, 3
+      n = n + 1
+      results(n) = a(i,j)
+      expect(n) = sum(a0(i,:) * b(:,j))
+    enddo
+  enddo
+  d = matmul(transpose(d), d)
+  do j = 1, 4
+    do i = 1, 4
+      n = n + 1
+      results(n) = d(i,j)
+      expect(n) = sum(d0(:,i) * d0(:,j))
+    enddo
+  enddo
+  v = matmul(v, b)
+  do i = 1, 3
+    n = n + 1
+    results(n) = v(i)
+    expect(n) = sum(v0 * b(:,i))
+  enddo
+
+  ! dot_product
+  s = dot_product(v0, w)
+  n = n + 1
+  results(n) = s
+  expect(n) = sum(v0 * w)
+  is = dot_product(ia, ib)
+  n = n + 1
+  results(n) = is
+  expect(n) = 4
+  ls = dot_product(l1, l2)
+  n = n + 1
+  results(n) = merge(1, 0, ls)
+  expect(n) = 1
+  ls = dot_product(l1, .not. l2)
+  n = n + 1
+  results(n) = merge(1, 0, ls)
+  expect(n) = 0
+
+  ! transpose
+  c = transpose(b)
+  do j = 1, 3
+    do i = 1, 3
+      n = n + 1
+      results(n) = c(i,j)
+      expect(n) = b(j,i)
+    enddo
+  enddo
+
+  call checkd(results, expect, NbrTests)
+end program
@@ -0,0 +1,132 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for finding the items of a namelist group and the members of its
+!* derived type items by name: a group large enough to be indexed, read
+!* several times and in any order, nested derived types, arrays of derived
+!* type, a member with the same name as an item, a group sharing items with
+!* another one, a small group, and unknown item and member names.
+
+program p
+  parameter(NbrTests=16)
+
+  type inner_t
+    integer :: x, y
+  end type
+  type outer_t
+    integer :: v1, a(3)
+    type(inner_t) :: in
+  end type
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, nr, ios
+  type(outer_t) :: t, q(2)
+  character(len=200) :: line
+  namelist /big/ v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, t, q
+  namelist /few/ v10, v1
+  namelist /two/ v5, t
+
+  nr = 0
+  expect = 0
+  results = 0
+  call clear
+
+  line = '&big v10=10, t%in%y=7, V1=1, q(2)%in%x=22, t%v1=-1, v5=5, ' // &
+         'q(1)%a(2)=12, t%a=1,2,3, v9=9 /'
+  read(line, nml=big)
+  nr = nr + 1
+  results(nr) = abs(v1 - 1) + abs(v5 - 5) + abs(v9 - 9) + abs(v10 - 10) + &
+                abs(v2) + abs(v3)
+  nr = nr + 1
+  results(nr) = abs(t%v1 + 1) + abs(t%in%y - 7) + abs(t%in%x)
+  nr = nr + 1
+  results(nr) = count(t%a /= (/ 1, 2, 3 /))
+  nr = nr + 1
+  results(nr) = abs(q(2)%in%x - 22) + abs(q(1)%a(2) - 12) + abs(q(1)%in%x)
+
+  ! the same group again, other items
+  call clear
+  line = '&big q(1)%v1=4, v2=2, q(2)%v1=5, t%in%x=6, v3=3 /'
+  read(line, nml=big)
+  nr = nr + 1
+  results(nr) = abs(v2 - 2) + abs(v3 - 3) + abs(v1)
+  nr = nr + 1
+  results(nr) = abs(q(1)%v1 - 4) + abs(q(2)%v1 - 5) + abs(t%in%x - 6)
+
+  ! groups sharing items
+  call clear
+  line = '&two t%in%x=8, v5=50 /'
+  read(line, nml=two)
+  nr = nr + 1
+  results(nr) = abs(v5 - 50) + abs(t%in%x - 8)
+  line = '&few v1=11, v10=100 /'
+  read(line, nml=few)
+  nr = nr + 1
+  results(nr) = abs(v1 - 11) + abs(v10 - 100)
+
+  ! unknown names
+  line = '&big v1=3, v11=4 /'
+  read(line, nml=big, iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  line = '&big t%in%z=1 /'
+  read(line, nml=big, iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  line = '&big t%v2=1 /'
+  read(line, nml=big, iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  line = '&big v1%x=1 /'
+  read(line, nml=big, iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  line = '&few v5=1 /'
+  read(line, nml=few, iostat=ios)
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+
+  ! and a good read after the errors
+  call clear
+  line = '&big v8=8, q(2)%in%y=9 /'
+  read(line, nml=big, iostat=ios)
+  nr = nr + 1
+  results(nr) = ios + abs(v8 - 8) + abs(q(2)%in%y - 9)
+
+  ! an external file
+  call clear
+  open(10, file='nml_index.dat', status='replace')
+  write(10, '(a)') '&big', ' v7 = 7,', ' t%in%y = 70,', ' v4 = 4', '/'
+  rewind(10)
+  read(10, nml=big)
+  nr = nr + 1
+  results(nr) = abs(v4 - 4) + abs(v7 - 7) + abs(t%in%y - 70)
+  rewind(10)
+  call clear
+  read(10, nml=big)
+  close(10, status='delete')
+  nr = nr + 1
+  results(nr) = abs(v4 - 4) + abs(v7 - 7) + abs(t%in%y - 70)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine clear
+    v1 = 0
+    v2 = 0
+    v3 = 0
+    v4 = 0
+    v5 = 0
+    v6 = 0
+    v7 = 0
+    v8 = 0
+    v9 = 0
+    v10 = 0
+    t = outer_t(0, 0, inner_t(0, 0))
+    q = t
+  end subroutine
+
+end program
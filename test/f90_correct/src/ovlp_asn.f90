@@ -0,0 +1,172 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for array assignments whose lhs overlaps the rhs.  Depending on the
+!* direction of the overlap the compiler may run the assignment in order,
+!* in reverse, or through a temp.
+
+program p
+  parameter(NbrTests=190)
+  parameter(n=10, m=3)
+
+  integer :: a(n), b(n), c(n,m), d(n,m), e(n,m)
+  logical :: msk(n)
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: i, j, k, it, nr, ne
+
+  nr = 0
+  ne = 0
+
+  ! forward is fine
+  a = (/ (i, i=1,n) /)
+  b = a
+  a(1:n-1) = a(2:n)
+  do i = 1, n-1
+    b(i) = b(i+1)
+  enddo
+  call put(a, b)
+
+  ! needs reversing
+  a = (/ (i, i=1,n) /)
+  b = a
+  a(2:n) = a(1:n-1)
+  do i = n, 2, -1
+    b(i) = b(i-1)
+  enddo
+  call put(a, b)
+
+  ! two references, both reversible
+  a = (/ (i, i=1,n) /)
+  b = a
+  a(4:n) = a(1:n-3) + a(4:n) * 2
+  do i = n, 4, -1
+    b(i) = b(i-3) + b(i) * 2
+  enddo
+  call put(a, b)
+
+  ! overlap in both directions
+  a = (/ (i, i=1,n) /)
+  b = a
+  e(:,1) = a
+  a(2:n-1) = a(1:n-2) + a(3:n)
+  do i = 2, n-1
+    b(i) = e(i-1,1) + e(i+1,1)
+  enddo
+  call put(a, b)
+
+  ! reversed section
+  a = (/ (i, i=1,n) /)
+  a(1:n) = a(n:1:-1)
+  b = (/ (n+1-i, i=1,n) /)
+  call put(a, b)
+
+  ! negative stride lhs
+  a = (/ (i, i=1,n) /)
+  b = a
+  a(n:2:-1) = a(n-1:1:-1)
+  do i = n, 2, -1
+    b(i) = b(i-1)
+  enddo
+  call put(a, b)
+
+  ! masked
+  a = (/ (i, i=1,n) /)
+  b = a
+  msk = mod(a, 3) /= 0
+  where (msk(2:n)) a(2:n) = a(1:n-1)
+  do i = n, 2, -1
+    if (msk(i)) b(i) = b(i-1)
+  enddo
+  call put(a, b)
+
+  ! 2-D, overlap in the first dimension
+  call init2
+  c(2:n,:) = c(1:n-1,:) + 1
+  do j = 1, m
+    do i = 2, n
+      d(i,j) = e(i-1,j) + 1
+    enddo
+  enddo
+  call put2(c, d)
+
+  ! 2-D, diagonal
+  call init2
+  c(2:n,2:m) = c(1:n-1,1:m-1)
+  do j = 2, m
+    do i = 2, n
+      d(i,j) = e(i-1,j-1)
+    enddo
+  enddo
+  call put2(c, d)
+
+  ! 2-D, opposite directions in the two dimensions
+  call init2
+  c(2:n,1:m-1) = c(1:n-1,2:m)
+  do j = 1, m-1
+    do i = 2, n
+      d(i,j) = e(i-1,j+1)
+    enddo
+  enddo
+  call put2(c, d)
+
+  ! forall
+  a = (/ (i, i=1,n) /)
+  b = a
+  forall (k = 3:n) a(k) = a(k-2) * 2
+  do k = n, 3, -1
+    b(k) = b(k-2) * 2
+  enddo
+  call put(a, b)
+
+  ! small constant-size temp
+  a = (/ (i, i=1,n) /)
+  b = a
+  a(1:4) = a(4:1:-1) + sum(a(1:4))
+  b(1:4) = (/ 14, 13, 12, 11 /)
+  call put(a, b)
+
+  ! temp inside a time-step loop
+  a = (/ (i, i=1,n) /)
+  b = a
+  do it = 1, 3
+    a(2:n-1) = a(1:n-2) - a(3:n)
+    e(:,1) = b
+    do i = 2, n-1
+      b(i) = e(i-1,1) - e(i+1,1)
+    enddo
+  enddo
+  call put(a, b)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine init2
+    do j = 1, m
+      do i = 1, n
+        c(i,j) = i + 100 * j
+      enddo
+    enddo
+    d = c
+    e = c
+  end subroutine
+
+  subroutine put(x, y)
+    integer :: x(:), y(:)
+    results(nr+1:nr+size(x)) = x
+    expect(ne+1:ne+size(y)) = y
+    nr = nr + size(x)
+    ne = ne + size(y)
+  end subroutine
+
+  subroutine put2(x, y)
+    integer :: x(:,:), y(:,:)
+    results(nr+1:nr+size(x)) = reshape(x, (/ size(x) /))
+    expect(ne+1:ne+size(y)) = reshape(y, (/ size(y) /))
+    nr = nr + size(x)
+    ne = ne + size(y)
+  end subroutine
+
+end program
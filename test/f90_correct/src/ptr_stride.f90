@@ -0,0 +1,200 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for loops over pointer arrays.  At -O2 such loops are versioned
+!* on the pointers having unit stride, so run each loop over contiguous
+!* targets, strided sections, components of derived type arrays,
+!* targets with lower bounds other than one and overlapping targets.
+
+module m
+  type et
+    integer :: v
+    real(8) :: d
+  end type
+end module
+
+program p
+  use m
+  parameter(NbrTests=130)
+  parameter(n=12, m=4)
+
+  integer, target :: x(n), y(n), u(n,m), v(n,m)
+  integer, target, allocatable :: z(:)
+  type(et), target :: t(n)
+  integer, pointer :: a(:), b(:), c(:,:), d(:,:)
+  integer :: w(n), e(n,m)
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: i, j, k, nr, ne
+
+  nr = 0
+  ne = 0
+
+  ! contiguous targets
+  call init
+  a => x
+  b => y
+  do i = 2, n-1
+    b(i) = a(i-1) + a(i) * 2 + a(i+1)
+  enddo
+  do i = 2, n-1
+    w(i) = x(i-1) + x(i) * 2 + x(i+1)
+  enddo
+  call put(y(2:n-1), w(2:n-1))
+
+  ! strided source
+  call init
+  a => x(1:n:2)
+  b => y
+  do i = 1, n/2
+    b(i) = a(i) * 3
+  enddo
+  do i = 1, n/2
+    w(i) = x(2*i-1) * 3
+  enddo
+  call put(y(1:n/2), w(1:n/2))
+
+  ! strided destination, reversed source
+  call init
+  a => x(n:1:-1)
+  b => y(2:n:2)
+  do i = 1, n/2
+    b(i) = a(i) - 1
+  enddo
+  w = (/ (100 + i, i=1,n) /)
+  do i = 1, n/2
+    w(2*i) = x(n+1-i) - 1
+  enddo
+  call put(y, w)
+
+  ! component of a derived type array
+  call init
+  do i = 1, n
+    t(i)%v = i * 10
+    t(i)%d = 0
+  enddo
+  a => t(2:n-1)%v
+  b => y
+  do i = 1, n-2
+    b(i) = a(i) + 1
+  enddo
+  w = (/ (100 + i, i=1,n) /)
+  do i = 1, n-2
+    w(i) = (i + 1) * 10 + 1
+  enddo
+  call put(y(1:n-2), w(1:n-2))
+
+  ! lower bound other than one, with a conditional
+  call init
+  allocate(z(-3:n-4))
+  z = x
+  a => z
+  b => y
+  do i = lbound(a,1), ubound(a,1)
+    if (mod(a(i), 2) == 0) then
+      b(i+4) = a(i)
+    else
+      b(i+4) = -a(i)
+    endif
+  enddo
+  do i = 1, n
+    if (mod(x(i), 2) == 0) then
+      w(i) = x(i)
+    else
+      w(i) = -x(i)
+    endif
+  enddo
+  call put(y, w)
+  deallocate(z)
+
+  ! rank 2, contiguous and strided
+  call init
+  c => u
+  d => v(:,m:1:-1)
+  do j = 1, m
+    do i = 2, n
+      d(i,j) = c(i-1,j) + c(i,j)
+    enddo
+  enddo
+  e = 0
+  do j = 1, m
+    do i = 2, n
+      e(i,m+1-j) = u(i-1,j) + u(i,j)
+    enddo
+  enddo
+  call put2(v(2:n,:), e(2:n,:))
+
+  ! rank 2 section whose rows are strided
+  call init
+  c => u(1:n:3, 2:m)
+  do j = 1, m-1
+    do i = 1, n/3
+      if (c(i,j) > 300) c(i,j) = 0
+    enddo
+  enddo
+  e = 0
+  do j = 2, m
+    do k = 1, n, 3
+      if (k + 100 * j <= 300) e(k,j) = k + 100 * j
+    enddo
+  enddo
+  call put2(u(1:n:3,2:m), e(1:n:3,2:m))
+
+  ! overlapping targets, each element stored is loaded by the next iteration
+  call init
+  a => x(1:n-1)
+  b => x(2:n)
+  do i = 1, size(a)
+    b(i) = a(i) * 2
+  enddo
+  w(1) = 1
+  do i = 2, n
+    w(i) = w(i-1) * 2
+  enddo
+  call put(x, w)
+
+  ! destination overlapping a target referenced directly
+  call init
+  b => y(2:n)
+  do i = 1, size(b)
+    b(i) = y(i) * 2
+  enddo
+  w(1) = 101
+  do i = 2, n
+    w(i) = w(i-1) * 2
+  enddo
+  call put(y, w)
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  subroutine init
+    x = (/ (i, i=1,n) /)
+    y = (/ (100 + i, i=1,n) /)
+    do j = 1, m
+      do i = 1, n
+        u(i,j) = i + 100 * j
+        v(i,j) = 0
+      enddo
+    enddo
+  end subroutine
+
+  subroutine put(r, s)
+    integer :: r(:), s(:)
+    results(nr+1:nr+size(r)) = r
+    expect(ne+1:ne+size(s)) = s
+    nr = nr + size(r)
+    ne = ne + size(s)
+  end subroutine
+
+  subroutine put2(r, s)
+    integer :: r(:,:), s(:,:)
+    results(nr+1:nr+size(r)) = reshape(r, (/ size(r) /))
+    expect(ne+1:ne+size(s)) = reshape(s, (/ size(s) /))
+    nr = nr + size(r)
+    ne = ne + size(s)
+  end subroutine
+
+end program
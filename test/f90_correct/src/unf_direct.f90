@@ -0,0 +1,135 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for direct access unformatted i/o: records written out of order
+!* and past the end of the file, short records padded with zeros, records
+!* larger than the i/o buffer, element by element and strided transfers,
+!* reads and writes mixed on one unit, the next record without REC=, a
+!* partial last record, and CONVERT='BIG_ENDIAN'.
+
+program p
+  parameter(NbrTests=24)
+  parameter(n=10, nbig=3000)
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: a(n), a2(2*n), big(nbig), big2(nbig), i, k, nr, ios, rl, rlb, ic
+  integer :: rec5(n), rec2(n), rec9(n)
+  character(len=16) :: cvt
+  integer(1) :: raw(8)
+
+  nr = 0
+  expect = 0
+  results = 0
+  rec5 = (/ (i * 5, i = 1, n) /)
+  rec2 = (/ (-i * 2, i = 1, n) /)
+  rec9 = (/ (i + 900, i = 1, n) /)
+  big = (/ (i * 31 - 7, i = 1, nbig) /)
+  inquire(iolength=rl) a
+  inquire(iolength=rlb) big
+
+  do ic = 1, 2
+    cvt = merge('NATIVE    ', 'BIG_ENDIAN', ic == 1)
+    open(10, file='unf_direct.dat', form='unformatted', access='direct', &
+         recl=rl, convert=cvt, status='replace')
+    write(10, rec=5) rec5
+    write(10, rec=2) rec2
+    write(10, rec=9) (rec9(i), i = 1, n)
+    write(10, rec=3) 77
+
+    ! record 3 is padded, 6 to 8 are a hole, 1 was never written
+    a = -1
+    read(10, rec=3) a
+    nr = nr + 1
+    results(nr) = abs(a(1) - 77) + count(a(2:) /= 0)
+    a = -1
+    read(10, rec=7) a
+    nr = nr + 1
+    results(nr) = count(a /= 0)
+
+    ! element by element, then strided, then the next record without REC=
+    a = 0
+    read(10, rec=5) (a(i), i = 1, n)
+    nr = nr + 1
+    results(nr) = count(a /= rec5)
+    a2 = 0
+    read(10, rec=9) a2(1:2*n:2)
+    nr = nr + 1
+    results(nr) = count(a2(1:2*n:2) /= rec9) + count(a2(2:2*n:2) /= 0)
+    a = 0
+    read(10, rec=2) a(1:3)
+    read(10) a(4:)
+    nr = nr + 1
+    results(nr) = count(a(1:3) /= rec2(1:3)) + abs(a(4) - 77) + &
+                  count(a(5:) /= 0)
+
+    ! overwrite a record with a shorter one and read it back
+    write(10, rec=5) 1, 2
+    a = -1
+    read(10, rec=5) a
+    nr = nr + 1
+    results(nr) = abs(a(1) - 1) + abs(a(2) - 2) + count(a(3:) /= 0)
+
+    ! a record past the last one
+    read(10, rec=10, iostat=ios) a
+    nr = nr + 1
+    results(nr) = merge(0, 1, ios /= 0)
+    close(10)
+
+    ! the bytes of record 9 as written
+    open(10, file='unf_direct.dat', form='unformatted', access='stream', &
+         status='old')
+    read(10, pos=8*rl+1) raw
+    close(10)
+    k = 0
+    do i = 1, 4
+      if (ic == 1) then
+        k = ior(k, ishft(iand(int(raw(i)), 255), 8 * (i - 1)))
+      else
+        k = ior(ishft(k, 8), iand(int(raw(i)), 255))
+      endif
+    enddo
+    nr = nr + 1
+    results(nr) = k - rec9(1)
+
+    ! records larger than the i/o buffer
+    open(10, file='unf_direct.dat', form='unformatted', access='direct', &
+         recl=rlb, convert=cvt, status='replace')
+    write(10, rec=3) big
+    write(10, rec=1) big(nbig:1:-1)
+    write(10, rec=2) 5
+    big2 = 0
+    read(10, rec=3) big2
+    nr = nr + 1
+    results(nr) = count(big2 /= big)
+    big2 = 0
+    read(10, rec=1) (big2(i), i = nbig, 1, -1)
+    nr = nr + 1
+    results(nr) = count(big2 /= big)
+    big2 = -1
+    read(10, rec=2) big2
+    nr = nr + 1
+    results(nr) = abs(big2(1) - 5) + count(big2(2:) /= 0)
+    close(10, status='delete')
+  enddo
+
+  ! a partial last record can be read up to its end
+  open(10, file='unf_direct.dat', form='unformatted', access='stream', &
+       status='replace')
+  write(10) rec5, rec2(1:3)
+  close(10)
+  open(10, file='unf_direct.dat', form='unformatted', access='direct', &
+       recl=rl, status='old')
+  a = 0
+  read(10, rec=2, iostat=ios) a(1:3)
+  nr = nr + 1
+  results(nr) = ios + count(a(1:3) /= rec2(1:3))
+  read(10, rec=2, iostat=ios) a
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios /= 0)
+  close(10, status='delete')
+
+  call check(results, expect, NbrTests)
+
+end program
@@ -0,0 +1,124 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for sequential unformatted records built from several transfers:
+!* many small items, a small item then a large one, a large item then a
+!* small one, and recursive i/o to another unit in the middle of a record.
+!* Each file is written natively and with CONVERT='BIG_ENDIAN'; the length
+!* words are checked through a stream read and the data is read back.
+
+module m
+  integer :: side
+contains
+  integer function logit(i)
+    integer :: i
+    write(side) i, (/ (i * k, k = 1, 2000) /)
+    logit = i
+  end function
+end module
+
+program p
+  use m
+  parameter(NbrTests=28)
+  parameter(n=3000, nb=200000)
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: a(n), a2(n), b(nb), b2(nb), x, x2, i, k, nr, pos, ic
+  integer :: lens(4), y(2001)
+  character(len=16) :: cvt
+  integer(1), allocatable :: raw(:)
+
+  nr = 0
+  expect = 0
+  results = 0
+  a = (/ (i * 3 - 1, i = 1, n) /)
+  b = (/ (i * 7 + 5, i = 1, nb) /)
+  x = 12345
+  lens = (/ n * 4, 4 + nb * 4, nb * 4 + 4, n * 4 /)
+
+  do ic = 1, 2
+    cvt = merge('NATIVE    ', 'BIG_ENDIAN', ic == 1)
+    side = 11
+    open(10, file='unf_rec.dat', form='unformatted', convert=cvt, &
+         status='replace')
+    open(11, file='unf_rec.side', form='unformatted', status='replace')
+    write(10) (a(i), i = 1, n)
+    write(10) x, b
+    write(10) b, x
+    write(10) (a(i), i = 1, n / 2), logit(7), (a(i), i = n / 2 + 2, n)
+    close(10)
+    close(11)
+
+    ! length words, through a stream read
+    open(10, file='unf_rec.dat', form='unformatted', access='stream', &
+         status='old')
+    inquire(10, size=k)
+    allocate(raw(k))
+    read(10) raw
+    close(10)
+    pos = 1
+    do k = 1, 4
+      call reclen(lens(k), ic == 2)
+      pos = pos + lens(k)
+      call reclen(lens(k), ic == 2)
+    enddo
+    nr = nr + 1
+    results(nr) = size(raw) + 1 - pos
+    deallocate(raw)
+
+    ! read back
+    open(10, file='unf_rec.dat', form='unformatted', convert=cvt, &
+         status='old')
+    a2 = 0
+    read(10) (a2(i), i = 1, n)
+    nr = nr + 1
+    results(nr) = count(a2 /= a)
+    b2 = 0
+    x2 = 0
+    read(10) x2, b2
+    nr = nr + 1
+    results(nr) = count(b2 /= b) + abs(x2 - x)
+    b2 = 0
+    x2 = 0
+    read(10) b2, x2
+    nr = nr + 1
+    results(nr) = count(b2 /= b) + abs(x2 - x)
+    a2 = 0
+    read(10) a2
+    nr = nr + 1
+    results(nr) = count(a2(1:n/2) /= a(1:n/2)) + abs(a2(n/2+1) - 7) + &
+                  count(a2(n/2+2:n) /= a(n/2+2:n))
+    close(10, status='delete')
+
+    open(11, file='unf_rec.side', form='unformatted', status='old')
+    read(11) y
+    close(11, status='delete')
+    nr = nr + 1
+    results(nr) = count(y /= (/ 7, (7 * k, k = 1, 2000) /))
+  enddo
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! check the length word at pos against len
+  subroutine reclen(len, big)
+    integer :: len, got, b
+    logical :: big
+
+    got = 0
+    do b = 4, 1, -1
+      if (big) then
+        got = ior(got, ishft(iand(int(raw(pos + 4 - b)), 255), 8 * (b - 1)))
+      else
+        got = ior(got, ishft(iand(int(raw(pos + b - 1)), 255), 8 * (b - 1)))
+      endif
+    enddo
+    pos = pos + 4
+    nr = nr + 1
+    results(nr) = got - len
+  end subroutine
+
+end program
@@ -0,0 +1,100 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for large ACCESS='STREAM' unformatted transfers mixed with small
+!* ones, run with FORTRANOPT=stream_direct so that the large ones bypass the
+!* stdio buffer: unaligned positions, POS= and INQUIRE after large
+!* transfers, overwriting in the middle of the file, strided transfers,
+!* appending, and a large read past the end of the file.
+
+program p
+  parameter(NbrTests=12)
+  parameter(n=100000)
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer :: a(n), b(n), h, h2, i, nr, ios, ps, sz
+  integer(1) :: c
+
+  nr = 0
+  expect = 0
+  results = 0
+  a = (/ (i * 3 + 1, i = 1, n) /)
+
+  open(10, file='unf_stream_direct.dat', form='unformatted', &
+       access='stream', status='replace')
+  c = 5
+  write(10) c, a
+  h = 77
+  write(10) h
+  inquire(10, pos=ps, size=sz)
+  nr = nr + 1
+  results(nr) = abs(ps - (4 * n + 6)) + abs(sz - (4 * n + 5))
+  write(10) a(n:1:-1)
+  close(10)
+
+  open(10, file='unf_stream_direct.dat', form='unformatted', &
+       access='stream', status='old')
+  c = 0
+  b = 0
+  read(10) c, b
+  nr = nr + 1
+  results(nr) = abs(c - 5) + count(b /= a)
+  h2 = 0
+  read(10) h2
+  nr = nr + 1
+  results(nr) = abs(h2 - 77)
+  b = 0
+  read(10) b
+  nr = nr + 1
+  results(nr) = count(b /= a(n:1:-1))
+
+  ! back to the start with POS=, then a small read after a large one
+  b = 0
+  read(10, pos=2) b(1:n/2)
+  read(10) h2
+  nr = nr + 1
+  results(nr) = count(b(1:n/2) /= a(1:n/2)) + abs(h2 - a(n/2+1))
+
+  ! overwrite the middle of the file and read around it
+  write(10, pos=6) a(n:1:-1)
+  read(10, pos=2) h2
+  nr = nr + 1
+  results(nr) = abs(h2 - a(1))
+  b = 0
+  read(10) b
+  nr = nr + 1
+  results(nr) = count(b /= a(n:1:-1))
+  inquire(10, pos=ps)
+  nr = nr + 1
+  results(nr) = abs(ps - (4 * n + 6))
+
+  ! strided, through the buffer
+  b = 0
+  read(10, pos=6) b(1:n:2)
+  nr = nr + 1
+  results(nr) = count(b(1:n:2) /= a(n:n/2+1:-1)) + count(b(2:n:2) /= 0)
+
+  ! a large read past the end of the file
+  read(10, pos=4*n+10, iostat=ios) b
+  nr = nr + 1
+  results(nr) = merge(0, 1, ios < 0)
+  close(10)
+
+  ! appending
+  open(10, file='unf_stream_direct.dat', form='unformatted', &
+       access='stream', status='old', position='append')
+  write(10) a
+  inquire(10, size=sz)
+  nr = nr + 1
+  results(nr) = abs(sz - (12 * n + 5))
+  b = 0
+  read(10, pos=8*n+6) b
+  nr = nr + 1
+  results(nr) = count(b /= a)
+  close(10, status='delete')
+
+  call check(results, expect, NbrTests)
+
+end program
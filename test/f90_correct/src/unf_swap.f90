@@ -0,0 +1,126 @@
+!** Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!** See https://llvm.org/LICENSE.txt for license information.
+!** SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!* Tests for unformatted i/o with CONVERT='BIG_ENDIAN'.  The records are
+!* written swapped, checked byte by byte through a stream read of the same
+!* file, then read back swapped.  The sizes cover data that fits in the i/o
+!* buffer, data that does not, and data larger than the swap staging buffer.
+
+program p
+  parameter(NbrTests=13)
+  parameter(nbig=300000)
+
+  integer :: expect(NbrTests)
+  integer :: results(NbrTests)
+  integer(2) :: h(3000), h2(3000)
+  integer(4) :: w(nbig), w2(nbig), s(10), s2(10)
+  integer(8) :: d(7), d2(7)
+  real(8) :: r(1000), r2(1000)
+  complex(4) :: c(1500), c2(1500)
+  integer(1), allocatable :: raw(:)
+  integer :: i, nr, pos, fsize
+
+  nr = 0
+  expect = 0
+  results = 0
+
+  h = (/ (int(i * 7 - 5000, 2), i = 1, size(h)) /)
+  w = (/ (i * 65599 + 3, i = 1, nbig) /)
+  s = (/ (i * 1000003, i = 1, 10) /)
+  d = (/ (int(i, 8) * 1000000007_8 * 1000003_8, i = 1, 7) /)
+  r = (/ (i / 3.0d0, i = 1, size(r)) /)
+  c = (/ (cmplx(i / 7.0, -i * 1.5), i = 1, size(c)) /)
+
+  open(10, file='unf_swap.dat', form='unformatted', convert='BIG_ENDIAN', &
+       status='replace')
+  write(10) h
+  write(10) w
+  write(10) d, r, c
+  write(10) w(1:2*size(s):2), d
+  close(10)
+
+  ! raw bytes: the swapped file through a stream read
+  open(10, file='unf_swap.dat', form='unformatted', access='stream', &
+       status='old')
+  inquire(10, size=fsize)
+  allocate(raw(fsize))
+  read(10) raw
+  close(10)
+
+  pos = 1
+  call rec(size(h) * 2)
+  call chk(transfer(h, raw), 2)
+  call rec(-1)
+
+  call rec(nbig * 4)
+  call chk(transfer(w, raw), 4)
+  call rec(-1)
+
+  call rec(size(d) * 8 + size(r) * 8 + size(c) * 8)
+  call chk(transfer(d, raw), 8)
+  call chk(transfer(r, raw), 8)
+  call chk(transfer(c, raw), 4)
+  call rec(-1)
+
+  call rec(size(s) * 4 + size(d) * 8)
+  call chk(transfer(w(1:2*size(s):2), raw), 4)
+  call chk(transfer(d, raw), 8)
+  call rec(-1)
+
+  ! read back, contiguous and strided
+  w2 = 0
+  open(10, file='unf_swap.dat', form='unformatted', convert='BIG_ENDIAN', &
+       status='old')
+  read(10) h2
+  read(10) w2
+  read(10) d2, r2, c2
+  read(10) w2(1:2*size(s):2), d2
+  close(10, status='delete')
+  s2 = w2(1:2*size(s):2)
+
+  nr = nr + 1
+  results(nr) = count(h2 /= h)
+  nr = nr + 1
+  results(nr) = count(w2(2*size(s)+1:) /= w(2*size(s)+1:))
+  nr = nr + 1
+  results(nr) = count(d2 /= d) + count(r2 /= r) + count(c2 /= c)
+  nr = nr + 1
+  results(nr) = count(s2 /= w(1:2*size(s):2))
+
+  call check(results, expect, NbrTests)
+
+contains
+
+  ! check a record length word; n < 0 checks the one ending the record
+  subroutine rec(n)
+    integer :: n
+    integer, save :: len
+    integer :: got, b
+
+    if (n >= 0) len = n
+    got = 0
+    do b = 1, 4
+      got = ior(ishft(got, 8), iand(int(raw(pos + b - 1)), 255))
+    enddo
+    pos = pos + 4
+    nr = nr + 1
+    results(nr) = got - len
+  end subroutine
+
+  ! check that each unit of sz bytes of x is in raw reversed
+  subroutine chk(x, sz)
+    integer(1) :: x(:)
+    integer :: sz, k, j, bad
+
+    bad = 0
+    do k = 0, size(x) / sz - 1
+      do j = 1, sz
+        if (raw(pos + k * sz + j - 1) /= x(k * sz + sz + 1 - j)) bad = bad + 1
+      enddo
+    enddo
+    pos = pos + size(x)
+    results(NbrTests) = results(NbrTests) + bad
+  end subroutine
+
+end program
@@ -0,0 +1,36 @@
+!
+! Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+! See https://llvm.org/LICENSE.txt for license information.
+! SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+!
+
+! Calls to ERF, GAMMA, BESSEL_J0 and the like name their libpgmath vector
+! entries, so a loop over them is vectorized into calls of those entries.
+
+! RUN: %flang -target x86_64-unknown-unknown %s -S -emit-llvm -o - | FileCheck %s --check-prefix=ATTR
+! RUN: %flang -target x86_64-unknown-unknown -O2 %s -S -emit-llvm -o - | FileCheck %s
+
+! ATTR: call {{.*}}double @__[[P:[frp]]]d_erf_1 (double {{.*}}) "vector-function-abi-variant"="_ZGV_LLVM_N2v___[[P]]d_erf_1(__[[P]]d_erf_2)
+! ATTR: call {{.*}}float @__[[P]]s_bessel_j0_1 (float {{.*}}) "vector-function-abi-variant"="_ZGV_LLVM_N4v___[[P]]s_bessel_j0_1(__[[P]]s_bessel_j0_4)
+! ATTR-DAG: declare <2 x double> @__[[P]]d_erf_2(<2 x double>)
+! ATTR-DAG: declare <4 x float> @__[[P]]s_bessel_j0_4(<4 x float>)
+! ATTR: @llvm.compiler.used = appending global [2 x i8*]
+
+! CHECK: call {{.*}}<2 x double> @__{{[frp]}}d_erf_2(<2 x double>
+! CHECK: call {{.*}}<4 x float> @__{{[frp]}}s_bessel_j0_4(<4 x float>
+
+subroutine derf_loop(x, y, n)
+  integer :: n, i
+  real(8) :: x(n), y(n)
+  do i = 1, n
+    y(i) = erf(x(i))
+  end do
+end subroutine
+
+subroutine sbessel_loop(x, y, n)
+  integer :: n, i
+  real(4) :: x(n), y(n)
+  do i = 1, n
+    y(i) = bessel_j0(x(i))
+  end do
+end subroutine
@@ -0,0 +1,15 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+red04: red04.$(OBJX)
+	@echo ------------ executing test $@
+	-$(RUN4) ./a.$(EXESUFFIX) $(LOG)
+red04.$(OBJX): $(SRC)/red04.f90 check.$(OBJX)
+	@echo ------------ building test $@
+	-$(F90) $(FFLAGS) -Mx,69,0x2000 $(SRC)/red04.f90
+	@$(RM) ./a.$(EXESUFFIX)
+	-$(F90) $(LDFLAGS) red04.$(OBJX) check.$(OBJX) $(LIBS) -o a.$(EXESUFFIX)
+build: red04
+run: ;
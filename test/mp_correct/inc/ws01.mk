@@ -0,0 +1,15 @@
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+ws01: ws01.$(OBJX)
+	@echo ------------ executing test $@
+	-$(RUN4) ./a.$(EXESUFFIX) $(LOG)
+ws01.$(OBJX): $(SRC)/ws01.f90 check.$(OBJX)
+	@echo ------------ building test $@
+	-$(F90) $(FFLAGS) $(SRC)/ws01.f90
+	@$(RM) ./a.$(EXESUFFIX)
+	-$(F90) $(LDFLAGS) ws01.$(OBJX) check.$(OBJX) $(LIBS) -o a.$(EXESUFFIX)
+build: ws01
+run: ;
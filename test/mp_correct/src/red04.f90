@@ -0,0 +1,75 @@
+!* Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!* See https://llvm.org/LICENSE.txt for license information.
+!* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!       host tree reductions (-Mx,69,0x2000) through __kmpc_reduce_nowait
+        program tomp
+        implicit none
+
+        integer n
+        parameter(n=1000)
+        integer i, isum, imax, imin, io, ix
+        integer(8) k8
+        real r
+        real(8) arr(3)
+        complex(8) z
+        logical land, lor, lneqv
+        integer result(12), expect(12)
+        data expect/12*1/
+
+        isum = 0; imax = -1; imin = n + 1; io = 0; ix = 0; k8 = 1
+        r = 0; arr = 0; z = 0
+        land = .true.; lor = .false.; lneqv = .false.
+!$omp   parallel do reduction(+:isum,r,arr,z) reduction(max:imax) &
+!$omp&  reduction(min:imin) reduction(ior:io) reduction(ieor:ix) &
+!$omp&  reduction(*:k8) reduction(.and.:land) reduction(.or.:lor) &
+!$omp&  reduction(.neqv.:lneqv)
+        do i = 1, n
+          isum = isum + i
+          r = r + 1.0
+          arr(1) = arr(1) + 1
+          arr(2) = arr(2) + 2
+          arr(3) = arr(3) + i
+          z = z + (1.0d0, 2.0d0)
+          imax = max(imax, i)
+          imin = min(imin, i)
+          io = ior(io, i)
+          ix = ieor(ix, 1)
+          if (i .le. 20) k8 = k8 * 2
+          land = land .and. (i .gt. 0)
+          lor = lor .or. (i .eq. n)
+          lneqv = lneqv .neqv. (i .eq. 3)
+        enddo
+
+        result = 0
+        if (isum .eq. n*(n+1)/2) result(1) = 1
+        if (r .eq. n) result(2) = 1
+        if (arr(1) .eq. n .and. arr(2) .eq. 2*n .and. &
+            arr(3) .eq. n*(n+1)/2) result(3) = 1
+        if (z .eq. cmplx(n, 2*n, 8)) result(4) = 1
+        if (imax .eq. n) result(5) = 1
+        if (imin .eq. 1) result(6) = 1
+        if (io .eq. 1023) result(7) = 1
+        if (ix .eq. 0) result(8) = 1
+        if (k8 .eq. 2_8**20) result(9) = 1
+        if (land .and. lor .and. lneqv) result(10) = 1
+
+        isum = 0
+!$omp   parallel
+!$omp   sections reduction(+:isum)
+!$omp   section
+        isum = isum + 1
+!$omp   section
+        isum = isum + 2
+!$omp   end sections
+!$omp   end parallel
+        if (isum .eq. 3) result(11) = 1
+
+        isum = 0
+!$omp   parallel reduction(+:isum)
+        isum = isum + 1
+!$omp   end parallel
+        if (isum .ge. 1) result(12) = 1
+
+        call check(result, expect, 12)
+        end
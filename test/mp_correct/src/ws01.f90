@@ -0,0 +1,67 @@
+!* Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+!* See https://llvm.org/LICENSE.txt for license information.
+!* SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+!       MATMUL inside WORKSHARE, split across the team
+        program tomp
+        implicit none
+
+        integer n, m, k
+        parameter(n=37, m=23, k=41)
+        real(8) a(n,m), b(m,k), c(n,k), e(n,k)
+        real(8) v(m), w(n), x(k), y(n), z(k)
+        integer ia(n,m), ib(m,k), ic(n,k)
+        integer i, j
+        integer result(5), expect(5)
+        data expect/5*1/
+
+        do j = 1, m
+          do i = 1, n
+            a(i,j) = mod(i + j, 7) - 3
+            ia(i,j) = mod(i * j, 5) - 2
+          enddo
+          v(j) = mod(j, 4)
+        enddo
+        do j = 1, k
+          do i = 1, m
+            b(i,j) = mod(i - j, 5)
+            ib(i,j) = mod(i + 2 * j, 3)
+          enddo
+        enddo
+
+        do j = 1, k
+          do i = 1, n
+            e(i,j) = sum(a(i,:) * b(:,j))
+          enddo
+        enddo
+        do i = 1, n
+          y(i) = sum(a(i,:) * v)
+        enddo
+        do j = 1, k
+          z(j) = sum(v * b(:,j))
+        enddo
+
+!$omp   parallel
+!$omp   workshare
+        c = matmul(a, b)
+        w = matmul(a, v)
+        x = matmul(v, b)
+        ic = matmul(ia, ib)
+!$omp   end workshare
+!$omp   end parallel
+
+        result = 0
+        if (all(c .eq. e)) result(1) = 1
+        if (all(w .eq. y)) result(2) = 1
+        if (all(x .eq. z)) result(3) = 1
+        if (all(ic .eq. matmul(ia, ib))) result(4) = 1
+
+        c = 0
+!$omp   parallel workshare
+        c(:, 2:k) = matmul(a, b(:, 2:k))
+!$omp   end parallel workshare
+        if (all(c(:, 2:k) .eq. e(:, 2:k)) .and. all(c(:, 1) .eq. 0)) &
+          result(5) = 1
+
+        call check(result, expect, 5)
+        end
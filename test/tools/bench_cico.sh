@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time <count> calls (default 10^5) passing a section x(1:n:s) of <n>
+# elements (default 10000) to an explicit-shape dummy, with s = 1 and s = 2
+# at run time.  With the run-time stride test (default) the s = 1 section is
+# passed in place; with it disabled (-Mx,58,0x2000000) every call copies in
+# and out.  Set FLANG_COPY_STATS=1 to see the bytes copied per call site.
+#
+# usage: bench_cico.sh <flang> [count] [n] [runs]
+#
+# The best wall time of <runs> runs is reported for each.
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [count] [n] [runs]"
+  exit 1
+fi
+
+fc=$1
+count=${2:-100000}
+n=${3:-10000}
+runs=${4:-3}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/cico.f90" <<EOF
+subroutine scale(b, n)
+  integer :: n
+  real(8) :: b(n)
+  b(1) = b(1) * 0.5d0 + b(n)
+end subroutine
+
+program bench
+  integer, parameter :: n = $n
+  integer(8) :: r
+  integer :: s
+  character(len=8) :: arg
+  real(8) :: x(2*n)
+  call get_command_argument(1, arg)
+  read(arg, *) s
+  x = 1
+  do r = 1, $count
+    call scale(x(1:s*n:s), n)
+  end do
+  print *, x(1)
+end program
+EOF
+"$fc" -O2 -o "$tmp/test" "$tmp/cico.f90" || exit 1
+"$fc" -O2 -Mx,58,0x2000000 -o "$tmp/copy" "$tmp/cico.f90" || exit 1
+
+best_time() {
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    "$@" >/dev/null 2>&1 || { echo fail; return; }
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%8s %10s %10s\n" stride copy test
+for s in 1 2; do
+  printf "%8s %10s %10s\n" $s "$(best_time "$tmp/copy" $s)" \
+    "$(best_time "$tmp/test" $s)"
+done
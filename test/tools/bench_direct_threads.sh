@@ -0,0 +1,97 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time direct access unformatted i/o on one unit shared by 1, 2, 4, ...
+# <maxthreads> (default 64) OpenMP threads.  A file of <nrec> records
+# (default 100000) of <recl> bytes (default 512) is written, then each
+# thread reads and rewrites its own records in a scattered order.  Every
+# run does the same total work, so perfect scaling would divide the time
+# by the thread count.  On Linux the number of read and write system calls
+# is shown too.  The file goes to <dir> (default a temporary directory).
+#
+# usage: bench_direct_threads.sh <flang> [maxthreads] [nrec] [recl] [dir]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [maxthreads] [nrec] [recl] [dir]"
+  exit 1
+fi
+
+fc=$1
+maxt=${2:-64}
+nrec=${3:-100000}
+recl=${4:-512}
+tmp=$(mktemp -d)
+dir=${5:-$tmp}
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/dirthr.f90" <<EOF
+program bench
+  integer, parameter :: nrec = $nrec, nw = $recl / 4
+  integer :: buf(nw), nt, k, r, i, j
+  integer(8) :: t0, t1, rate, cr, cw
+
+  buf = 1
+  open(10, file='$dir/dirthr.dat', form='unformatted', access='direct', &
+       recl=$recl, status='replace')
+  do k = 1, nrec
+    write(10, rec=k) buf
+  enddo
+  print '(a8, a12, a12, a12)', 'threads', 'seconds', 'syscr', 'syscw'
+  nt = 1
+  do while (nt <= $maxt)
+    call sysc(cr, cw)
+    call system_clock(t0, rate)
+!\$omp parallel do num_threads(nt) private(r, buf, j) schedule(static)
+    do i = 0, nrec - 1
+      ! a scattered permutation of the records
+      r = int(mod(int(i, 8) * 7919_8, int(nrec, 8))) + 1
+      read(10, rec=r) (buf(j), j = 1, nw)
+      buf(1) = buf(1) + 1
+      write(10, rec=r) buf
+    enddo
+    call system_clock(t1)
+    call sysc(cr, cw, .true.)
+    print '(i8, f12.3, i12, i12)', nt, real(t1 - t0) / rate, cr, cw
+    nt = nt * 2
+  enddo
+  close(10, status='delete')
+
+contains
+
+  ! read and write system calls so far, or since the last call if since
+  subroutine sysc(cr, cw, since)
+    integer(8) :: cr, cw, c
+    logical, optional :: since
+    character(len=80) :: line
+    integer :: ios
+    integer(8) :: r0, w0
+
+    r0 = 0
+    w0 = 0
+    if (present(since)) then
+      r0 = cr
+      w0 = cw
+    endif
+    cr = -1
+    cw = -1
+    open(12, file='/proc/self/io', status='old', iostat=ios)
+    if (ios /= 0) return
+    do
+      read(12, '(a)', iostat=ios) line
+      if (ios /= 0) exit
+      if (line(1:6) == 'syscr:') read(line(7:), *) c
+      if (line(1:6) == 'syscr:') cr = c - r0
+      if (line(1:6) == 'syscw:') read(line(7:), *) c
+      if (line(1:6) == 'syscw:') cw = c - w0
+    enddo
+    close(12)
+  end subroutine
+
+end program
+EOF
+"$fc" -O2 -mp -o "$tmp/dirthr" "$tmp/dirthr.f90" || exit 1
+"$tmp/dirthr"
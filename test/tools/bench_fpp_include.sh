@@ -0,0 +1,57 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Time preprocessing of a header-heavy source: a large guarded parameter
+# header reached hundreds of times through nested includes.
+#
+# usage: bench_fpp_include.sh <baseline-flang> <new-flang> [includes] [runs]
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <baseline-flang> <new-flang> [includes] [runs]"
+  exit 1
+fi
+
+base=$1
+new=$2
+count=${3:-500}
+runs=${4:-5}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+awk 'BEGIN {
+  print "#ifndef PARAMS_H"
+  print "#define PARAMS_H"
+  for (i = 0; i < 2000; ++i)
+    printf "#define P%d %d\n", i, i
+  print "#endif"
+}' > "$tmp/params.h"
+# the wrapper has no guard of its own, so it is re-read every time
+printf '#include "params.h"\n#include "params.h"\n' > "$tmp/wrap.h"
+awk -v n="$count" 'BEGIN {
+  print "subroutine s(a)"
+  print "  integer :: a"
+  for (i = 0; i < n; ++i) {
+    print "#include \"wrap.h\""
+    printf "  a = a + P%d\n", i % 2000
+  }
+  print "end subroutine"
+}' > "$tmp/heavy.F90"
+
+for compiler in "$base" "$new"; do
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    (cd "$tmp" && "$compiler" -E heavy.F90 >/dev/null) || echo fail
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo "$compiler: $best s"
+done
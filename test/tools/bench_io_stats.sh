@@ -0,0 +1,80 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time <n> (default 200000) small formatted writes, list-directed reads
+# and direct access unformatted writes, with the i/o statistics off, with
+# FLANG_IO_STATS set and with FLANG_IO_TRACE set too, to show the cost of
+# collecting them.  Then <threads> (default 4) OpenMP threads write to one
+# unit and the FLANG_IO_STATS table, with the time spent waiting for the
+# i/o lock, is shown.  The files go to <dir> (default a temporary
+# directory).
+#
+# usage: bench_io_stats.sh <flang> [n] [threads] [dir]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [n] [threads] [dir]"
+  exit 1
+fi
+
+fc=$1
+n=${2:-200000}
+nt=${3:-4}
+tmp=$(mktemp -d)
+dir=${4:-$tmp}
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/iost.f90" <<EOF
+program bench
+  integer :: i, k, buf(16)
+  real :: r
+  integer(8) :: t0, t1, rate
+
+  buf = 1
+  call system_clock(t0, rate)
+  open(10, file='$dir/iost.txt', status='replace')
+  do i = 1, $n
+    write(10, '(i8, f12.4)') i, i * 0.5
+  enddo
+  rewind(10)
+  do i = 1, $n
+    read(10, *) k, r
+  enddo
+  close(10, status='delete')
+  open(11, file='$dir/iost.dat', form='unformatted', access='direct', &
+       recl=64, status='replace')
+  do i = 1, $n
+    write(11, rec=i) buf
+  enddo
+  close(11, status='delete')
+  call system_clock(t1)
+  print '(f12.3, a)', real(t1 - t0) / rate, ' seconds'
+end program
+EOF
+
+cat > "$tmp/iostmp.f90" <<EOF
+program bench
+  integer :: i
+
+  open(10, file='$dir/iostmp.txt', status='replace')
+!\$omp parallel do num_threads($nt)
+  do i = 1, $n
+    write(10, '(i8, f12.4)') i, i * 0.5
+  enddo
+  close(10, status='delete')
+end program
+EOF
+
+"$fc" -O2 -o "$tmp/iost" "$tmp/iost.f90" || exit 1
+"$fc" -O2 -mp -o "$tmp/iostmp" "$tmp/iostmp.f90" || exit 1
+echo "statistics off"
+"$tmp/iost"
+echo "FLANG_IO_STATS"
+FLANG_IO_STATS=1 "$tmp/iost" 2>/dev/null
+echo "FLANG_IO_STATS and FLANG_IO_TRACE"
+FLANG_IO_STATS=1 FLANG_IO_TRACE="$tmp/trace.json" "$tmp/iost" 2>/dev/null
+echo "$nt threads writing to one unit"
+FLANG_IO_STATS=1 "$tmp/iostmp"
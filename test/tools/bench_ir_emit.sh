@@ -0,0 +1,58 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Compare LLVM IR emission time of two flang builds on the largest Fortran
+# sources in the test tree.
+#
+# usage: bench_ir_emit.sh <baseline-flang> <new-flang> [count] [runs]
+#
+# Each source is compiled with -S -emit-llvm (and again with -g) <runs>
+# times per compiler; the best wall time of each is reported.
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <baseline-flang> <new-flang> [count] [runs]"
+  exit 1
+fi
+
+base=$1
+new=$2
+count=${3:-10}
+runs=${4:-3}
+testdir=$(cd "$(dirname "$0")/.." && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+best_time() {
+  compiler=$1
+  src=$2
+  shift 2
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    "$compiler" -S -emit-llvm "$@" -o "$tmp/out.ll" "$src" \
+      -J "$tmp" >/dev/null 2>&1 || { echo fail; return; }
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%-40s %6s %10s %10s\n" source flags baseline new
+find "$testdir" \( -name '*.f90' -o -name '*.f' -o -name '*.F90' \) \
+    -printf '%s %p\n' | sort -rn | head -n "$count" |
+while read size src; do
+  for flags in "-O0" "-O0 -g"; do
+    tb=$(best_time "$base" "$src" $flags)
+    tn=$(best_time "$new" "$src" $flags)
+    printf "%-40s %6s %10s %10s\n" "$(basename "$src")" "$flags" "$tb" "$tn"
+  done
+done
@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Time -O2 compilation of generated sources holding 1000, 2000, 4000 and
+# 8000 small subroutines (or the counts given) and print the time per
+# subprogram, which should stay flat as the file grows.
+#
+# usage: bench_many_units.sh <flang> [count...]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [count...]"
+  exit 1
+fi
+
+fc=$1
+shift
+counts=${*:-"1000 2000 4000 8000"}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+for n in $counts; do
+  awk -v n="$n" 'BEGIN {
+    for (i = 0; i < n; ++i) {
+      printf "subroutine s%d(a, b, n)\n", i
+      printf "  integer :: n, i\n"
+      printf "  real :: a(n), b(n), t\n"
+      printf "  t = 0\n"
+      printf "  do i = 1, n\n"
+      printf "    a(i) = b(i) * %d.0 + sqrt(abs(b(i)))\n", i
+      printf "    t = t + a(i)\n"
+      printf "  enddo\n"
+      printf "  if (t > 100.0) then\n"
+      printf "    write(*,*) \"big\", t\n"
+      printf "  endif\n"
+      printf "  call s%d(b, a, n - 1)\n", (i + 1) % n
+      printf "end subroutine\n"
+    }
+  }' > "$tmp/u$n.f90"
+  start=$(date +%s.%N)
+  (cd "$tmp" && "$fc" -O2 -c u$n.f90) || echo fail
+  end=$(date +%s.%N)
+  awk -v n="$n" -v s="$start" -v e="$end" 'BEGIN {
+    printf "%6d subprograms: %8.2f s %8.3f ms each\n", n, e - s,
+           (e - s) * 1000 / n
+  }'
+done
@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Time -O2 compilation of a generated module holding 250, 500, 1000 and
+# 2000 module procedures (or the counts given) and print the time per
+# procedure.  The module state is restored for every procedure, so this
+# shows how that cost grows with the size of the module.
+#
+# usage: bench_module_procs.sh <flang> [count...]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [count...]"
+  exit 1
+fi
+
+fc=$1
+shift
+counts=${*:-"250 500 1000 2000"}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+for n in $counts; do
+  awk -v n="$n" 'BEGIN {
+    printf "module m%d\n", n
+    printf "  implicit none\n"
+    printf "  real :: g(100)\n"
+    printf "contains\n"
+    for (i = 0; i < n; ++i) {
+      printf "  subroutine s%d(a, b, n)\n", i
+      printf "    integer :: n, i\n"
+      printf "    real :: a(n), b(n), t\n"
+      printf "    t = 0\n"
+      printf "    do i = 1, n\n"
+      printf "      a(i) = b(i) * %d.0 + g(mod(i, 100) + 1)\n", i
+      printf "      t = t + a(i)\n"
+      printf "    enddo\n"
+      printf "    if (t > 100.0) then\n"
+      printf "      write(*,*) \"big\", t\n"
+      printf "    endif\n"
+      printf "    call s%d(b, a, n - 1)\n", (i + 1) % n
+      printf "  end subroutine\n"
+    }
+    printf "end module\n"
+  }' > "$tmp/m$n.f90"
+  start=$(date +%s.%N)
+  (cd "$tmp" && "$fc" -O2 -c m$n.f90) || echo fail
+  end=$(date +%s.%N)
+  awk -v n="$n" -v s="$start" -v e="$end" 'BEGIN {
+    printf "%6d procedures: %8.2f s %8.3f ms each\n", n, e - s,
+           (e - s) * 1000 / n
+  }'
+done
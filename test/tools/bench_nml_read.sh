@@ -0,0 +1,67 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time NAMELIST reads of a synthetic configuration: a group of <n> real
+# scalars (default 2000) followed by a derived type item with <n> / 4
+# components, where the input sets every scalar and every component once,
+# in reverse order.  The group is read <reads> times (default 200) and the
+# time per read is printed.
+#
+# usage: bench_nml_read.sh <flang> [n] [reads]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [n] [reads]"
+  exit 1
+fi
+
+fc=$1
+n=${2:-2000}
+reads=${3:-200}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+awk -v n=$n -v reads=$reads -v dir="$tmp" 'BEGIN {
+  m = int(n / 4)
+  print "program bench"
+  print "  type cfg_t"
+  for (i = 1; i <= m; i++)
+    print "    real(8) :: c" i
+  print "  end type"
+  print "  type(cfg_t) :: p"
+  for (i = 1; i <= n; i++)
+    print "  real(8) :: v" i
+  for (i = 1; i <= n; i++)
+    printf "%s%s", (i % 10 == 1 ? "  namelist /cfg/ v" i : ", v" i), \
+      (i % 10 == 0 || i == n ? "\n" : "")
+  print "  namelist /cfg/ p"
+  print "  integer :: k"
+  print "  integer(8) :: t0, t1, rate"
+  print "  open(10, file=\"" dir "/nml.in\", status=\"old\")"
+  print "  call system_clock(t0, rate)"
+  print "  do k = 1, " reads
+  print "    rewind(10)"
+  print "    read(10, nml=cfg)"
+  print "  enddo"
+  print "  call system_clock(t1)"
+  print "  print \"(i8, a, f10.3, a)\", " n ", \" items:\", &"
+  print "    1000.0 * real(t1 - t0) / rate / " reads ", \" ms per read\""
+  print "  if (v1 /= 1 .or. p%c1 /= 1) print *, \"wrong values\""
+  print "end program"
+}' > "$tmp/nml.f90"
+
+awk -v n=$n 'BEGIN {
+  m = int(n / 4)
+  print "&cfg"
+  for (i = n; i >= 1; i--)
+    print " v" i " = " i ".0,"
+  for (i = m; i >= 1; i--)
+    print " p%c" i " = " i ".0,"
+  print "/"
+}' > "$tmp/nml.in"
+
+"$fc" -O2 -o "$tmp/nml" "$tmp/nml.f90" || exit 1
+"$tmp/nml"
@@ -0,0 +1,73 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Compare the default critical-section reduction with the host tree
+# reduction (-Mx,69,0x2000) on a short parallel loop whose cost is dominated
+# by the combine step.
+#
+# usage: bench_omp_reduction.sh <flang> [threads] [reps] [runs]
+#
+# <threads> is a space separated list of OMP_NUM_THREADS values; the best
+# wall time of <runs> runs is reported for each.
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [threads] [reps] [runs]"
+  exit 1
+fi
+
+fc=$1
+threads=${2:-"2 4 8 16 32"}
+reps=${3:-20000}
+runs=${4:-3}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/red.f90" <<EOF
+program bench
+  integer, parameter :: n = 1024
+  real(8) :: a(n), s, v(4)
+  integer :: i, r, m
+  a = 1
+  do r = 1, $reps
+    s = 0
+    m = 0
+    v = 0
+!\$omp parallel do reduction(+:s,v) reduction(max:m)
+    do i = 1, n
+      s = s + a(i)
+      v(mod(i, 4) + 1) = v(mod(i, 4) + 1) + a(i)
+      m = max(m, i)
+    end do
+  end do
+  if (s /= n .or. m /= n .or. sum(v) /= n) print *, 'FAIL'
+end program
+EOF
+
+"$fc" -O2 -fopenmp -o "$tmp/crit" "$tmp/red.f90" || exit 1
+"$fc" -O2 -fopenmp -Mx,69,0x2000 -o "$tmp/tree" "$tmp/red.f90" || exit 1
+
+best_time() {
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    OMP_NUM_THREADS=$2 "$1" >/dev/null 2>&1 || { echo fail; return; }
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%8s %10s %10s\n" threads critical tree
+for t in $threads; do
+  printf "%8s %10s %10s\n" $t "$(best_time "$tmp/crit" $t)" \
+    "$(best_time "$tmp/tree" $t)"
+done
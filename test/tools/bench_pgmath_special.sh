@@ -0,0 +1,133 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Compare the throughput of the scalar and vector libpgmath entry points for
+# ERF, ERFC, ERFC_SCALED, GAMMA, LOG_GAMMA and BESSEL_J0/J1/Y0/Y1.  Each
+# function is applied <n> times (default 4000000) to arguments in a range
+# where it is finite, once through __mth_i_* and once through each of the
+# __fs/__fd vector entries the host can run, and the rate is printed in
+# millions of elements per second.
+#
+# usage: bench_pgmath_special.sh <cc> <libpgmath-dir> [n]
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <cc> <libpgmath-dir> [n]"
+  exit 1
+fi
+
+cc=$1
+lib=$2
+n=${3:-4000000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/special.c" <<EOF
+#include <stdio.h>
+#include <time.h>
+
+#define N 4096
+#define REPS ($n / N)
+
+typedef float vrs4_t __attribute__((vector_size(16)));
+typedef float vrs8_t __attribute__((vector_size(32)));
+typedef float vrs16_t __attribute__((vector_size(64)));
+typedef double vrd2_t __attribute__((vector_size(16)));
+typedef double vrd4_t __attribute__((vector_size(32)));
+typedef double vrd8_t __attribute__((vector_size(64)));
+
+static float xs[N] __attribute__((aligned(64))), ys[N] __attribute__((aligned(64)));
+static double xd[N] __attribute__((aligned(64))), yd[N] __attribute__((aligned(64)));
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void
+report(const char *name, double t)
+{
+  printf(" %9.1f", (double)REPS * N / t * 1e-6);
+}
+
+#define SCALAR(f, x, y)                                                      \\
+  do {                                                                       \\
+    double t = now();                                                        \\
+    for (int r = 0; r < REPS; r++)                                           \\
+      for (int i = 0; i < N; i++)                                            \\
+        y[i] = f(x[i]);                                                      \\
+    report(#f, now() - t);                                                   \\
+  } while (0)
+
+#define VECTOR(f, vt, x, y)                                                  \\
+  do {                                                                       \\
+    int vl = sizeof(vt) / sizeof(x[0]);                                      \\
+    double t = now();                                                        \\
+    for (int r = 0; r < REPS; r++)                                           \\
+      for (int i = 0; i < N; i += vl)                                        \\
+        *(vt *)&y[i] = f(*(vt *)&x[i]);                                      \\
+    report(#f, now() - t);                                                   \\
+  } while (0)
+
+#if defined(__AVX512F__)
+#define WIDE(f, vt, x, y) VECTOR(f, vt, x, y)
+#define WIDER(f, vt, x, y) VECTOR(f, vt, x, y)
+#elif defined(__AVX__)
+#define WIDE(f, vt, x, y) VECTOR(f, vt, x, y)
+#define WIDER(f, vt, x, y) printf(" %9s", "-")
+#else
+#define WIDE(f, vt, x, y) printf(" %9s", "-")
+#define WIDER(f, vt, x, y) printf(" %9s", "-")
+#endif
+
+#define BENCH(name, lo, hi)                                                  \\
+  do {                                                                       \\
+    float __mth_i_##name(float);                                             \\
+    double __mth_i_d##name(double);                                          \\
+    vrs4_t __fs_##name##_4(vrs4_t);                                          \\
+    vrs8_t __fs_##name##_8(vrs8_t);                                          \\
+    vrs16_t __fs_##name##_16(vrs16_t);                                       \\
+    vrd2_t __fd_##name##_2(vrd2_t);                                          \\
+    vrd4_t __fd_##name##_4(vrd4_t);                                          \\
+    vrd8_t __fd_##name##_8(vrd8_t);                                          \\
+    for (int i = 0; i < N; i++)                                              \\
+      xd[i] = xs[i] = lo + (hi - lo) * (i + 0.5) / N;                        \\
+    printf("%-12s real(4)", #name);                                          \\
+    SCALAR(__mth_i_##name, xs, ys);                                          \\
+    VECTOR(__fs_##name##_4, vrs4_t, xs, ys);                                 \\
+    WIDE(__fs_##name##_8, vrs8_t, xs, ys);                                   \\
+    WIDER(__fs_##name##_16, vrs16_t, xs, ys);                                \\
+    printf("\n%-12s real(8)", #name);                                        \\
+    SCALAR(__mth_i_d##name, xd, yd);                                         \\
+    VECTOR(__fd_##name##_2, vrd2_t, xd, yd);                                 \\
+    WIDE(__fd_##name##_4, vrd4_t, xd, yd);                                   \\
+    WIDER(__fd_##name##_8, vrd8_t, xd, yd);                                  \\
+    printf("\n");                                                            \\
+  } while (0)
+
+int
+main(void)
+{
+  printf("Melem/s %12s %9s %9s %9s %9s\n", "", "scalar", "128", "256", "512");
+  BENCH(erf, -5.0, 5.0);
+  BENCH(erfc, -5.0, 20.0);
+  BENCH(erfc_scaled, -5.0, 100.0);
+  BENCH(gamma, 0.1, 30.0);
+  BENCH(log_gamma, 0.1, 1000.0);
+  BENCH(bessel_j0, -50.0, 50.0);
+  BENCH(bessel_j1, -50.0, 50.0);
+  BENCH(bessel_y0, 0.1, 50.0);
+  BENCH(bessel_y1, 0.1, 50.0);
+  return 0;
+}
+EOF
+"$cc" -O2 -march=native -o "$tmp/special" "$tmp/special.c" \
+  -L"$lib" -Wl,-rpath,"$lib" -lpgmath -lm || exit 1
+"$tmp/special"
@@ -0,0 +1,106 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time 1-D and 2-D stencil kernels over pointer arrays with the unit stride
+# versioning of their loop nests (default) and with it disabled
+# (-Mx,47,0x40).  The same kernels on assumed-shape dummies are timed for
+# reference; those are passed contiguous through copy-in and are not
+# versioned.
+#
+# usage: bench_ptr_stencil.sh <flang> [n] [reps] [runs]
+#
+# The best wall time of <runs> runs is reported for each.
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [n] [reps] [runs]"
+  exit 1
+fi
+
+fc=$1
+n=${2:-1000}
+reps=${3:-100}
+runs=${4:-3}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/st.f90" <<EOF
+module kernels
+contains
+  subroutine ptr1(a, b)
+    real(8), pointer :: a(:), b(:)
+    integer :: i
+    do i = 2, size(a) - 1
+      b(i) = (a(i-1) + a(i) + a(i+1)) / 3
+    end do
+  end subroutine
+  subroutine ptr2(a, b)
+    real(8), pointer :: a(:,:), b(:,:)
+    integer :: i, j
+    do j = 2, size(a, 2) - 1
+      do i = 2, size(a, 1) - 1
+        b(i,j) = (a(i-1,j) + a(i+1,j) + a(i,j-1) + a(i,j+1)) / 4
+      end do
+    end do
+  end subroutine
+  subroutine asm2(a, b)
+    real(8) :: a(:,:), b(:,:)
+    integer :: i, j
+    do j = 2, size(a, 2) - 1
+      do i = 2, size(a, 1) - 1
+        b(i,j) = (a(i-1,j) + a(i+1,j) + a(i,j-1) + a(i,j+1)) / 4
+      end do
+    end do
+  end subroutine
+end module
+
+program bench
+  use kernels
+  real(8), pointer :: x(:), y(:), u(:,:), v(:,:)
+  integer :: r
+  allocate(x($n * $n), y($n * $n), u($n, $n), v($n, $n))
+  call random_number(x)
+  call random_number(u)
+  y = 0
+  v = 0
+  do r = 1, $reps
+    call KERNEL
+  end do
+  print *, sum(y), sum(v)
+end program
+EOF
+
+for k in ptr1 ptr2 asm2; do
+  case $k in
+  ptr1) call="ptr1(x, y); call ptr1(y, x)" ;;
+  *) call="$k(u, v); call $k(v, u)" ;;
+  esac
+  sed "s/KERNEL/$call/" "$tmp/st.f90" > "$tmp/$k.f90"
+  "$fc" -O2 -o "$tmp/$k.ver" "$tmp/$k.f90" || exit 1
+  "$fc" -O2 -Mx,47,0x40 -o "$tmp/$k.nover" "$tmp/$k.f90" || exit 1
+done
+
+best_time() {
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    "$1" >/dev/null 2>&1 || { echo fail; return; }
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%8s %10s %10s\n" kernel plain versioned
+for k in ptr1 ptr2 asm2; do
+  printf "%8s %10s %10s\n" $k "$(best_time "$tmp/$k.nover")" \
+    "$(best_time "$tmp/$k.ver")"
+done
@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time <count> 3x3 and 4x4 MATMULs (default 10^8) with the small-shape
+# expansion (default) and with it disabled (-Mx,47,0x200), which calls the
+# runtime MATMUL instead.
+#
+# usage: bench_small_matmul.sh <flang> [count] [runs]
+#
+# The best wall time of <runs> runs is reported for each.
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [count] [runs]"
+  exit 1
+fi
+
+fc=$1
+count=${2:-100000000}
+runs=${3:-3}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+for n in 3 4; do
+  cat > "$tmp/mm$n.f90" <<EOF
+program bench
+  integer, parameter :: n = $n
+  integer(8) :: r
+  real(8) :: a(n,n), b(n,n), c(n,n), s
+  call random_number(a)
+  call random_number(b)
+  b = b / n
+  s = 0
+  do r = 1, $count / 2
+    c = matmul(a, b)
+    a = matmul(c, b)
+    s = s + a(1,1)
+  end do
+  print *, s
+end program
+EOF
+  "$fc" -O2 -o "$tmp/inline$n" "$tmp/mm$n.f90" || exit 1
+  "$fc" -O2 -Mx,47,0x200 -o "$tmp/rt$n" "$tmp/mm$n.f90" || exit 1
+done
+
+best_time() {
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s.%N)
+    "$1" >/dev/null 2>&1 || { echo fail; return; }
+    end=$(date +%s.%N)
+    t=$(echo "$end - $start" | bc)
+    if [ -z "$best" ] || [ $(echo "$t < $best" | bc) = 1 ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%6s %10s %10s\n" shape runtime inline
+for n in 3 4; do
+  printf "%6s %10s %10s\n" ${n}x$n "$(best_time "$tmp/rt$n")" \
+    "$(best_time "$tmp/inline$n")"
+done
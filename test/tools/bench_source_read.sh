@@ -0,0 +1,48 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Measure front-end source throughput on a large generated file, both
+# directly (.f90) and through the preprocessor (.F90).
+#
+# usage: bench_source_read.sh <baseline-flang> <new-flang> [megabytes]
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <baseline-flang> <new-flang> [megabytes]"
+  exit 1
+fi
+
+base=$1
+new=$2
+mb=${3:-50}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Mostly comment lines, which every reader must still consume, around a
+# small amount of real code.
+awk -v bytes=$((mb * 1024 * 1024)) 'BEGIN {
+  print "subroutine big(a, n)"
+  print "  integer :: n, i"
+  print "  real :: a(n)"
+  line = "! " sprintf("%070d", 0)
+  for (size = 0; size < bytes; size += 3 * (length(line) + 1) + 40) {
+    print line
+    print line
+    print line
+    print "  a(1) = a(1) + 1.0 ! statement"
+  }
+  print "end subroutine"
+}' > "$tmp/big.f90"
+cp "$tmp/big.f90" "$tmp/big.F90"
+
+for src in big.f90 big.F90; do
+  for compiler in "$base" "$new"; do
+    start=$(date +%s.%N)
+    (cd "$tmp" && "$compiler" -c "$src") || echo fail
+    end=$(date +%s.%N)
+    awk -v s="$start" -v e="$end" -v mb="$mb" -v what="$src $compiler" \
+      'BEGIN { printf "%s: %.2f s, %.1f MB/s\n", what, e - s, mb / (e - s) }'
+  done
+done
@@ -0,0 +1,109 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time ACCESS='STREAM' unformatted i/o of a file of <mb> megabytes (default
+# 512): a 4 byte header followed by the data, written and read
+#   whole:  as one array,
+#   chunks: as arrays of <kb> kilobytes (default 256),
+# first through the stdio buffer and then with FORTRANOPT=stream_direct.  On
+# Linux the number of read and write system calls is shown too.  The file
+# goes to <dir> (default a temporary directory).
+#
+# usage: bench_stream_io.sh <flang> [mb] [kb] [dir]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [mb] [kb] [dir]"
+  exit 1
+fi
+
+fc=$1
+mb=${2:-512}
+kb=${3:-256}
+tmp=$(mktemp -d)
+dir=${4:-$tmp}
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/strio.f90" <<EOF
+program bench
+  integer(8), parameter :: n = $mb * 131072_8, m = $kb * 128
+  real(8), allocatable :: a(:)
+  integer(8) :: k
+  integer :: h
+
+  allocate(a(n))
+  a = 1
+  h = 7
+  print '(a8, a8, a12, a12, a12)', 'case', 'op', 'seconds', 'syscr', 'syscw'
+  call start('replace')
+  write(10) h, a
+  call done('whole', 'write')
+  call start('old')
+  read(10) h, a
+  call done('whole', 'read')
+  call start('replace')
+  write(10) h
+  do k = 1, n, m
+    write(10) a(k:min(n, k + m - 1))
+  enddo
+  call done('chunks', 'write')
+  call start('old')
+  read(10) h
+  do k = 1, n, m
+    read(10) a(k:min(n, k + m - 1))
+  enddo
+  call done('chunks', 'read')
+  open(10, file='$dir/strio.dat')
+  close(10, status='delete')
+
+contains
+
+  subroutine start(status)
+    character(len=*) :: status
+    integer(8) :: t0, c0(2)
+    common /tm/ t0, c0
+    call sysc(c0)
+    call system_clock(t0)
+    open(10, file='$dir/strio.dat', form='unformatted', access='stream', &
+         status=status)
+  end subroutine
+
+  subroutine done(what, op)
+    character(len=*) :: what, op
+    integer(8) :: t0, c0(2), t1, rate, c1(2)
+    common /tm/ t0, c0
+    close(10)
+    call system_clock(t1, rate)
+    call sysc(c1)
+    print '(a8, a8, f12.3, i12, i12)', what, op, real(t1 - t0) / rate, &
+          c1 - c0
+  end subroutine
+
+  ! read and write system calls so far
+  subroutine sysc(c)
+    integer(8) :: c(2)
+    character(len=80) :: line
+    integer :: ios
+
+    c = -1
+    open(12, file='/proc/self/io', status='old', iostat=ios)
+    if (ios /= 0) return
+    do
+      read(12, '(a)', iostat=ios) line
+      if (ios /= 0) exit
+      if (line(1:6) == 'syscr:') read(line(7:), *) c(1)
+      if (line(1:6) == 'syscw:') read(line(7:), *) c(2)
+    enddo
+    close(12)
+  end subroutine
+
+end program
+EOF
+"$fc" -O2 -o "$tmp/strio" "$tmp/strio.f90" || exit 1
+echo "stdio buffer"
+"$tmp/strio"
+echo "FORTRANOPT=stream_direct"
+FORTRANOPT=stream_direct "$tmp/strio"
@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Time the front end on a generated source with many distinct identifiers
+# of the form var_000001, which stresses the symbol hash table.
+#
+# usage: bench_symtab_hash.sh <baseline-flang> <new-flang> [identifiers]
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <baseline-flang> <new-flang> [identifiers]"
+  exit 1
+fi
+
+base=$1
+new=$2
+count=${3:-200000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Spread the declarations over modules so no single scope is unreasonable.
+awk -v n="$count" 'BEGIN {
+  per = 5000
+  for (m = 0; m * per < n; ++m) {
+    printf "module m%d\n", m
+    for (i = m * per; i < (m + 1) * per && i < n; ++i)
+      printf "  integer :: var_%06d = %d\n", i, i
+    printf "end module\n"
+  }
+  printf "program p\n"
+  for (m = 0; m * per < n; ++m)
+    printf "  use m%d\n", m
+  printf "  print *, var_%06d\n", n - 1
+  printf "end program\n"
+}' > "$tmp/ids.f90"
+
+for compiler in "$base" "$new"; do
+  start=$(date +%s.%N)
+  (cd "$tmp" && "$compiler" -c ids.f90) || echo fail
+  end=$(date +%s.%N)
+  echo "$compiler: $(echo "$end - $start" | bc) s"
+done
@@ -0,0 +1,100 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Time sequential unformatted writes of
+#   small: 10^6 records of two scalars,
+#   multi: 20000 records of 3000 items each transferred separately
+#          ((v(i), w(i), i = 1, 1500), 12 KB),
+#   huge:  4 records of a 64 MB array followed by a scalar,
+# natively and with CONVERT='BIG_ENDIAN'.  On Linux the number of write
+# system calls is shown too.  The file goes to <dir> (default a temporary
+# directory); use a network file system to see the cost of seeks.
+#
+# usage: bench_unf_records.sh <flang> [dir]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [dir]"
+  exit 1
+fi
+
+fc=$1
+tmp=$(mktemp -d)
+dir=${2:-$tmp}
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/unfrec.f90" <<EOF
+program bench
+  integer, parameter :: m = 1500, nbig = 16 * 1024 * 1024
+  integer :: v(m), w(m), i, k, ic
+  integer, allocatable :: big(:)
+  real(8) :: x
+  character(len=16) :: cvt
+
+  allocate(big(nbig))
+  v = 1
+  w = 2
+  big = 3
+  x = 4
+  print '(a8, a8, a12, a12)', 'convert', 'case', 'seconds', 'syscw'
+  do ic = 1, 2
+    cvt = merge('NATIVE    ', 'BIG_ENDIAN', ic == 1)
+    call start
+    do k = 1, 1000000
+      write(10) k, x
+    enddo
+    call done('small')
+    call start
+    do k = 1, 20000
+      write(10) (v(i), w(i), i = 1, m)
+    enddo
+    call done('multi')
+    call start
+    do k = 1, 4
+      write(10) big, k
+    enddo
+    call done('huge')
+  enddo
+
+contains
+
+  subroutine start
+    integer(8) :: t0, c0
+    common /tm/ t0, c0
+    c0 = syscw()
+    call system_clock(t0)
+    open(10, file='$dir/unfrec.dat', form='unformatted', convert=cvt, &
+         status='replace')
+  end subroutine
+
+  subroutine done(what)
+    character(len=*) :: what
+    integer(8) :: t0, c0, t1, rate
+    common /tm/ t0, c0
+    close(10, status='delete')
+    call system_clock(t1, rate)
+    print '(a8, a8, f12.3, i12)', trim(cvt(1:6)), what, &
+          real(t1 - t0) / rate, syscw() - c0
+  end subroutine
+
+  integer(8) function syscw()
+    character(len=80) :: line
+    integer :: ios
+    syscw = -1
+    open(12, file='/proc/self/io', status='old', iostat=ios)
+    if (ios /= 0) return
+    do
+      read(12, '(a)', iostat=ios) line
+      if (ios /= 0) exit
+      if (line(1:6) == 'syscw:') read(line(7:), *) syscw
+    enddo
+    close(12)
+  end function
+
+end program
+EOF
+"$fc" -O2 -o "$tmp/unfrec" "$tmp/unfrec.f90" || exit 1
+"$tmp/unfrec"
@@ -0,0 +1,85 @@
+#!/bin/sh
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+
+# Compare the throughput of native and CONVERT='BIG_ENDIAN' unformatted
+# i/o.  Each run writes and then reads back <mb> megabytes (default 256) of
+# real(8), real(4) and integer(2) data, one record per array, and prints
+# MB/s for the writes and the reads.  The files go to <dir> (default a
+# temporary directory), so put it on the file system of interest.
+#
+# usage: bench_unf_swap.sh <flang> [mb] [dir]
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <flang> [mb] [dir]"
+  exit 1
+fi
+
+fc=$1
+mb=${2:-256}
+tmp=$(mktemp -d)
+dir=${3:-$tmp}
+trap 'rm -rf "$tmp"' EXIT
+
+cat > "$tmp/unfswap.f90" <<EOF
+program bench
+  integer, parameter :: mb = $mb
+  real(8), allocatable :: d(:)
+  real(4), allocatable :: r(:)
+  integer(2), allocatable :: h(:)
+  character(len=16) :: cvt
+
+  allocate(d(mb * 131072), r(mb * 262144), h(mb * 524288))
+  d = 1.5d0
+  r = 2.5
+  h = 3
+  print '(a8, 3a14)', 'convert', 'type', 'write MB/s', 'read MB/s'
+  do i = 1, 2
+    cvt = merge('NATIVE    ', 'BIG_ENDIAN', i == 1)
+    call run(cvt, 'real(8)', 8)
+    call run(cvt, 'real(4)', 4)
+    call run(cvt, 'integer(2)', 2)
+  enddo
+
+contains
+
+  subroutine run(cvt, what, sz)
+    character(len=*) :: cvt, what
+    integer :: sz
+    integer(8) :: t0, t1, t2, rate
+
+    open(10, file='$dir/unfswap.dat', form='unformatted', convert=cvt, &
+         status='replace')
+    call system_clock(t0, rate)
+    select case (sz)
+    case (8)
+      write(10) d
+    case (4)
+      write(10) r
+    case (2)
+      write(10) h
+    end select
+    flush(10)
+    call system_clock(t1)
+    rewind(10)
+    select case (sz)
+    case (8)
+      read(10) d
+    case (4)
+      read(10) r
+    case (2)
+      read(10) h
+    end select
+    call system_clock(t2)
+    close(10, status='delete')
+    print '(a8, a14, 2f14.1)', trim(cvt(1:6)), what, &
+          mb * real(rate) / max(t1 - t0, 1_8), mb * real(rate) / max(t2 - t1, 1_8)
+  end subroutine
+
+end program
+EOF
+"$fc" -O2 -o "$tmp/unfswap" "$tmp/unfswap.f90" || exit 1
+"$tmp/unfswap"
@@ -196,7 +196,8 @@ static char ctable[256] = {
 #define pperr(n, sev) pperror(n, CNULL, sev)
 
 #define LINELEN 12000
-#define HASHSIZ 1031
+#define HASHSIZ 4099
+#define INCLHASHSIZ 127
 #define TOKMAX 8192
 #define IFMAX 20
 #define MACMAX 6000
@@ -272,6 +273,7 @@ typedef struct {
   INT name;
   INT value;
   INT next;
+  INT hash; /* pp_hash() of name, checked before comparing names */
 } PPSYM;
 
 /* include stack */
@@ -307,6 +309,23 @@ static INT nhash, next_hash;
 static char *deftab;
 static INT ndef, next_def;
 
+/* Contents of every file included so far, so that repeated inclusions are
+ * served from memory.  'guard' names the macro of an #ifndef/#endif pair
+ * enclosing everything but white space in the file; while that macro is
+ * defined, including the file again has no effect and is skipped. */
+typedef struct {
+  char *fname;
+  char *text;
+  size_t size;
+  char *guard;
+  INT hash;
+  INT next;
+} INCLCACHE;
+
+static INCLCACHE *inclcache;
+static INT ninclcache, inclcache_avl;
+static INT inclcache_hash[INCLHASHSIZ];
+
 /* suffix for dependent file, usually .o */
 #ifdef TARGET_WIN
 static char *suffix = ".obj";
@@ -655,6 +674,10 @@ static void putmac(PPSYM *);
 static void putunmac(char *);
 static void update_actuals(char **, int, char *, char *);
 static int skipbl(char *tokval, int flag);
+static INT pp_hash(const char *);
+static INCLCACHE *incl_cache(const char *);
+static FILE *incl_open(const char *, INCLCACHE *);
+static char *find_guard(const char *, size_t);
 
 static int
 skipbl(char *tokval, int flag)
@@ -1191,7 +1214,7 @@ accpp(void)
     pperr(218, 3);
 
   if (!flg.es)
-    (void)fseek(gbl.cppfil, 0L, 0);
+    cpp_rewind();
 
 /* -M option:  Print list of include files to stdout */
 /* -MD option:  Print list of include files to file <program>.d */
@@ -1216,6 +1239,14 @@ accpp(void)
 
   FREE(deftab);
   FREE(hashrec);
+  for (i = 1; i < inclcache_avl; ++i) {
+    FREE(inclcache[i].fname);
+    FREE(inclcache[i].text);
+    if (inclcache[i].guard)
+      FREE(inclcache[i].guard);
+  }
+  if (inclcache)
+    FREE(inclcache);
   /* FREE(inclstack); Do not free this, gbl.curr_file points to it */
   FREE(_ifs);
   FREE(linebuf);
@@ -2064,6 +2095,177 @@ add_to_incllist(char *fullname)
   incfiles++;
 }
 
+/** \brief
+ * Return the cache entry for the include file fullname, reading the file on
+ * first use.  Returns NULL if the file cannot be read.
+ */
+static INCLCACHE *
+incl_cache(const char *fullname)
+{
+  INT h, p;
+  FILE *f;
+  char *text;
+  size_t size, n;
+
+  h = pp_hash(fullname);
+  for (p = inclcache_hash[h % INCLHASHSIZ]; p; p = inclcache[p].next)
+    if (inclcache[p].hash == h && strcmp(inclcache[p].fname, fullname) == 0)
+      return &inclcache[p];
+
+  if ((f = fopen(fullname, "r")) == NULL)
+    return NULL;
+  size = 0;
+  n = 4096;
+  NEW(text, char, n);
+  while (1) {
+    size += fread(text + size, 1, n - size, f);
+    if (size < n)
+      break;
+    NEED(n + 1, text, char, n, n * 2);
+  }
+  fclose(f);
+
+  if (inclcache == NULL) {
+    ninclcache = 32;
+    NEW(inclcache, INCLCACHE, ninclcache);
+    inclcache_avl = 1;
+  }
+  p = inclcache_avl++;
+  NEED(inclcache_avl, inclcache, INCLCACHE, ninclcache, ninclcache * 2);
+  NEW(inclcache[p].fname, char, strlen(fullname) + 1);
+  strcpy(inclcache[p].fname, fullname);
+  inclcache[p].text = text;
+  inclcache[p].size = size;
+  inclcache[p].guard = find_guard(text, size);
+  inclcache[p].hash = h;
+  inclcache[p].next = inclcache_hash[h % INCLHASHSIZ];
+  inclcache_hash[h % INCLHASHSIZ] = p;
+  return &inclcache[p];
+}
+
+/** \brief
+ * Open an include file for reading, from its cached contents if possible.
+ */
+static FILE *
+incl_open(const char *fullname, INCLCACHE *ic)
+{
+#if !defined(TARGET_WIN)
+  FILE *f;
+
+  /* fmemopen may reject a zero-sized buffer */
+  if (ic != NULL && ic->size != 0 &&
+      (f = fmemopen(ic->text, ic->size, "r")) != NULL)
+    return f;
+#endif
+  return fopen(fullname, "r");
+}
+
+/* Skip blanks and tabs; return a pointer to the first other character. */
+static const char *
+skip_blanks(const char *p, const char *end)
+{
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    ++p;
+  return p;
+}
+
+/* If p..end starts a directive, return a pointer to its keyword and set
+ * *len to the keyword length; otherwise return NULL. */
+static const char *
+directive(const char *p, const char *end, int *len)
+{
+  const char *k;
+
+  p = skip_blanks(p, end);
+  if (p == end || *p != '#')
+    return NULL;
+  k = p = skip_blanks(p + 1, end);
+  while (p < end && isident(*p))
+    ++p;
+  *len = p - k;
+  return k;
+}
+
+/** \brief
+ * Find the include guard of a file: the macro tested by an initial
+ * "#ifndef X" or "#if !defined(X)" whose matching "#endif" ends the file,
+ * with nothing but white space outside the pair and no #else or #elif at
+ * the outer level.  Returns the macro name, or NULL if the file is not
+ * guarded this way.
+ */
+static char *
+find_guard(const char *text, size_t size)
+{
+  const char *p, *q, *eol, *end, *k, *name;
+  int len, depth, nlen;
+  char *guard;
+
+  end = text + size;
+  name = NULL;
+  nlen = 0;
+  depth = 0;
+  for (p = text; p < end; p = eol + 1) {
+    eol = memchr(p, '\n', end - p);
+    if (eol == NULL)
+      eol = end;
+    q = skip_blanks(p, eol);
+    if (q == eol)
+      continue; /* blank line */
+    if (eol > p && eol[-1] == '\\')
+      return NULL; /* don't try to follow continued directives */
+    if (depth == 0 && name != NULL)
+      return NULL; /* something follows the guard's #endif */
+    k = directive(q, eol, &len);
+    if (k == NULL) {
+      if (depth == 0)
+        return NULL; /* text before the guard */
+      continue;
+    }
+    if (depth == 0) {
+      /* must be the guard itself */
+      q = k + len;
+      if (len == 6 && strncmp(k, "ifndef", 6) == 0) {
+        q = skip_blanks(q, eol);
+      } else if (len == 2 && strncmp(k, "if", 2) == 0) {
+        q = skip_blanks(q, eol);
+        if (q == eol || *q != '!')
+          return NULL;
+        q = skip_blanks(q + 1, eol);
+        if (eol - q < 7 || strncmp(q, "defined", 7) != 0)
+          return NULL;
+        q = skip_blanks(q + 7, eol);
+        if (q == eol || *q != '(')
+          return NULL;
+        q = skip_blanks(q + 1, eol);
+      } else
+        return NULL;
+      name = q;
+      while (q < eol && isident(*q))
+        ++q;
+      nlen = q - name;
+      if (nlen == 0 || nlen > MAXIDLEN)
+        return NULL;
+      depth = 1;
+      continue;
+    }
+    if ((len == 2 && strncmp(k, "if", 2) == 0) ||
+        (len == 5 && strncmp(k, "ifdef", 5) == 0) ||
+        (len == 6 && strncmp(k, "ifndef", 6) == 0))
+      ++depth;
+    else if (len == 5 && strncmp(k, "endif", 5) == 0)
+      --depth;
+    else if (depth == 1 && ((len == 4 && strncmp(k, "else", 4) == 0) ||
+                            (len == 4 && strncmp(k, "elif", 4) == 0)))
+      return NULL;
+  }
+  if (name == NULL || depth != 0)
+    return NULL;
+  NEW(guard, char, nlen + 1);
+  memcpy(guard, name, nlen);
+  guard[nlen] = '\0';
+  return guard;
+}
+
 /** \param type:
  * <pre>
  * -0  --  "file_name"
@@ -2076,6 +2278,7 @@ _doincl(char *name, int type, LOGICAL include_next)
   char fullname[MAX_PATHNAME_LEN];
   char *p;
   int i;
+  INCLCACHE *ic;
 
   NEED(inclev + 2, inclstack, INCLSTACK, incsize, incsize + MAXINC);
 
@@ -2105,10 +2308,16 @@ _doincl(char *name, int type, LOGICAL include_next)
   return;
 
 found:
+  ic = incl_cache(fullname);
+  if (ic != NULL && ic->guard != NULL && lookup(ic->guard, 0) != NULL) {
+    /* already included and still guarded: the file contributes nothing */
+    add_to_incllist(fullname);
+    return;
+  }
   /* we need to increment the line # for this level */
   ++inclstack[inclev].lineno;
   ++inclev;
-  if ((ifp = inclstack[inclev].ifp = fopen(fullname, "r")) == NULL) {
+  if ((ifp = inclstack[inclev].ifp = incl_open(fullname, ic)) == NULL) {
     --inclev; /* failed to open file so retract changes */
     --inclstack[inclev].lineno;
     error(2, 4, 0, fullname, CNULL);
@@ -3051,37 +3260,19 @@ static PPSYM *
 lookup(char *name, int insflg)
 {
   int i;
-  char *cp;
   INT p, q;
-  INT l, m;
+  INT h;
   char buff[MAXIDLEN + 1];
 
   /* need to make sure not defining a predef macro */
-  i = 0;
-  l = m = (INT)0;
-
-  strncpy(buff, name, MAXIDLEN);
-  buff[MAXIDLEN] = 0;
-  /*
-   * break name into 3 byte chunks, sum them together, take remainder
-   * modulo table size
-   */
-  cp = buff;
-  while (*cp != '\0') {
-    if (i == 3) {
-      i = 0;
-      m += l;
-      l = (INT)0;
-    }
-    ++i;
-    l <<= 8;
-    l |= MASK(*cp);
-    cp++;
-  }
-  m += l;
-  i = m % HASHSIZ;
+  for (i = 0; i < MAXIDLEN && name[i]; ++i)
+    ;
+  memcpy(buff, name, i);
+  buff[i] = 0;
+  h = pp_hash(buff);
+  i = h % HASHSIZ;
   for (q = 0, p = hashtab[i]; p != 0; q = p, p = hashrec[p].next) {
-    if (strcmp(buff, &deftab[hashrec[p].name]) == 0) {
+    if (hashrec[p].hash == h && strcmp(buff, &deftab[hashrec[p].name]) == 0) {
       if (insflg) {
         if (hashrec[p].flags & F_PREDEF) {
           /* can't def */
@@ -3109,6 +3300,7 @@ lookup(char *name, int insflg)
   }
   hashrec[p].value = 0;
   hashrec[p].name = strstore(buff);
+  hashrec[p].hash = h;
   hashrec[p].flags = 0;
   hashrec[p].nformals = 0;
   if (q == 0) {
@@ -3121,37 +3313,29 @@ lookup(char *name, int insflg)
   return &hashrec[p];
 }
 
+/* FNV-1a hash of a macro or file name */
+static INT
+pp_hash(const char *name)
+{
+  unsigned int h = 2166136261U;
+
+  while (*name)
+    h = (h ^ MASK(*name++)) * 16777619U;
+  return (INT)(h & 0x7fffffff);
+}
+
 static void delete (char *name)
 {
   int i;
-  INT l, m;
+  INT h;
   INT p, q;
-  char *cp;
-
-  i = 0;
-  l = m = (INT)0;
 
   if ((int)strlen(name) > MAXIDLEN)
     name[MAXIDLEN] = 0;
-  /*
-   * break name into 3 byte chunks, sum them together, take remainder
-   * modulo table size
-   */
-  cp = name;
-  while (*cp != '\0') {
-    if (i == 3) {
-      i = 0;
-      m += l;
-      l = (INT)0;
-    }
-    ++i;
-    l <<= 8;
-    l |= *cp++;
-  }
-  m += l;
-  i = m % HASHSIZ;
+  h = pp_hash(name);
+  i = h % HASHSIZ;
   for (q = 0, p = hashtab[i]; p != 0; q = p, p = hashrec[p].next)
-    if (strcmp(name, &deftab[hashrec[p].name]) == 0)
+    if (hashrec[p].hash == h && strcmp(name, &deftab[hashrec[p].name]) == 0)
       goto found;
   return;
 found:
@@ -3207,7 +3391,7 @@ ptok(char *tok)
   if (!XBIT(123, 0x20) && !XBIT(123, 0x200)) {
     if (needspace && !iswhite(*tok) && MASK(*tok) != WHITESPACE &&
         *tok != '\n') {
-      (void)putc(' ', fp);
+      (void)FE_PUTC(' ', fp);
       ++nchars;
       needspace = 0;
     }
@@ -3229,7 +3413,7 @@ ptok(char *tok)
 
   needspace = !(iswhite(*tok) || *tok == '\n');
   while (*tok) {
-    (void)putc(*tok++, fp);
+    (void)FE_PUTC(*tok++, fp);
     ++nchars;
   }
 }
@@ -4693,7 +4877,7 @@ again:
   fp = ifp;
   lineptr = linebuf + linelen;
   startline = inclstack[inclev].lineno;
-  if ((c = getc(fp)) == EOF) {
+  if ((c = FE_GETC(fp)) == EOF) {
     if (inclev <= 0)
       return (EOF);
     fn = inclstack[inclev].fname;
@@ -4731,7 +4915,7 @@ joinlines:
       p += diff;
     }
     *p++ = c;
-    if ((c = getc(fp)) == '?')
+    if ((c = FE_GETC(fp)) == '?')
       isquest = 1;
     ++i;
   }
@@ -4775,7 +4959,7 @@ joinlines:
   if (dojoin) {
     firstime = 0;
     savestart = start;
-    c = getc(fp);
+    c = FE_GETC(fp);
     goto joinlines;
   }
   return *lineptr++;
@@ -57,6 +57,7 @@ static int hex2char(INT *);
 static int hex2nchar(INT *);
 static void truncation_warning(int);
 static void conversion_warning(void);
+static void dump_hash_stat(FILE *);
 
 static int atemps; /* temp counter for bounds' temporaries */
 
@@ -7292,6 +7293,37 @@ dump_stg_stat(char *where)
   fprintf(fil, "  SHD   :%8d\n", astb.shd.stg_avail);
   fprintf(fil, "  SYM   :%8d\n", stb.stg_avail);
   fprintf(fil, "  DT    :%8d\n", stb.dt.stg_avail);
+  dump_hash_stat(fil);
+}
+
+/* Symbol hash table occupancy and chain lengths */
+static void
+dump_hash_stat(FILE *fil)
+{
+  int h, len, used, longest, total;
+  int hist[5]; /* chains of length 1, 2, 3-4, 5-8, >8 */
+  SPTR sptr;
+
+  used = longest = total = 0;
+  BZERO(hist, int, 5);
+  for (h = 0; h < HASHSIZE; ++h) {
+    len = 0;
+    for (sptr = stb.hashtb[h]; sptr > NOSYM; sptr = HASHLKG(sptr))
+      ++len;
+    if (len == 0)
+      continue;
+    ++used;
+    total += len;
+    if (len > longest)
+      longest = len;
+    hist[len == 1 ? 0 : len == 2 ? 1 : len <= 4 ? 2 : len <= 8 ? 3 : 4]++;
+  }
+  fprintf(fil, "  HASH  :%8d buckets, %d used, %d hashed, longest %d", HASHSIZE,
+          used, total, longest);
+  if (used)
+    fprintf(fil, ", mean %.2f", (double)total / used);
+  fprintf(fil, "\n  chains: 1:%d 2:%d 3-4:%d 5-8:%d >8:%d\n", hist[0],
+          hist[1], hist[2], hist[3], hist[4]);
 }
 
 #include <stdarg.h>
@@ -1694,6 +1694,8 @@ void rw_dinit_state(RW_ROUTINE, RW_FILE)
   int lineno;
   FILE *readfile;
   FILE *writefile;
+  int (*p_read)(void *, size_t, size_t, FILE *);
+  int (*p_write)(void *, size_t, size_t, FILE *);
   int i;
   int sptr;
   int seq_astb_df;
@@ -1713,7 +1715,9 @@ void rw_dinit_state(RW_ROUTINE, RW_FILE)
 
     /* restore, read saved state and write dinit file */
     readfile = fd; /* from parameter RW_FILE */
+    p_read = p_rw;
     writefile = astb.df;
+    p_write = (RW_ROUTINE_TYPE)fwrite;
   } else {
     if (astb.df == NULL) {
       /* this can happen if there are errors */
@@ -1727,26 +1731,28 @@ void rw_dinit_state(RW_ROUTINE, RW_FILE)
 #endif
     /* save, read dinit file and write saved state */
     readfile = astb.df;
+    p_read = (RW_ROUTINE_TYPE)fread;
     seq_astb_df = 1;
     writefile = fd; /* from parameter RW_FILE */
+    p_write = p_rw;
   }
 
   RW_SCALAR(sem.dinit_nbr_inits);
 
   for (i = sem.dinit_nbr_inits; i;) {
-    nw = fread(&lineno, sizeof(lineno), 1, readfile);
+    nw = (*p_read)(&lineno, sizeof(lineno), 1, readfile);
     if (nw != 1)
       break;
 
-    nw = fread(&fileno, sizeof(fileno), 1, readfile);
+    nw = (*p_read)(&fileno, sizeof(fileno), 1, readfile);
     if (nw != 1)
       break;
 
-    nw = fread(&ivl, sizeof(VAR *), 1, readfile);
+    nw = (*p_read)(&ivl, sizeof(VAR *), 1, readfile);
     if (nw != 1)
       break;
 
-    nw = fread(&ict, sizeof(ACL *), 1, readfile);
+    nw = (*p_read)(&ict, sizeof(ACL *), 1, readfile);
     if (nw != 1)
       break;
 
@@ -1757,19 +1763,19 @@ void rw_dinit_state(RW_ROUTINE, RW_FILE)
       continue;
     }
 
-    nw = fwrite(&lineno, sizeof(lineno), 1, writefile);
+    nw = (*p_write)(&lineno, sizeof(lineno), 1, writefile);
     if (nw != 1)
       break;
 
-    nw = fwrite(&fileno, sizeof(fileno), 1, writefile);
+    nw = (*p_write)(&fileno, sizeof(fileno), 1, writefile);
     if (nw != 1)
       break;
 
-    nw = fwrite(&ivl, sizeof(VAR *), 1, writefile);
+    nw = (*p_write)(&ivl, sizeof(VAR *), 1, writefile);
     if (nw != 1)
       break;
 
-    nw = fwrite(&ict, sizeof(ACL *), 1, writefile);
+    nw = (*p_write)(&ict, sizeof(ACL *), 1, writefile);
     if (nw != 1)
       break;
 
@@ -126,6 +126,7 @@ int trans_getbound(int, int);
 void rewrite_forall(void);
 void rewrite_forall_pure(void);
 LOGICAL is_dependent(int lhs, int rhs, int forall, int, int);
+LOGICAL is_sequential_dependent(int lhs, int rhs, int forall, int, int);
 LOGICAL is_pointer_dependent(int sptr, int sptr1);
 void emit_alnd_secd(int, int, LOGICAL, int, int);
 int get_allobnds(int, int);
@@ -726,7 +726,7 @@ fpp(void)
     pperr(238, 3);
 
   if (!flg.es)
-    (void)fseek(gbl.cppfil, 0L, 0);
+    cpp_rewind();
 
   FREE(argbuf);
   FREE(deftab);
@@ -1567,7 +1567,7 @@ ptok(char *tok)
   }
   fp = gbl.cppfil;
   while (*tok)
-    (void)putc(*tok++, fp);
+    (void)FE_PUTC(*tok++, fp);
 }
 
 /*---------------------------------------------------------------*/
@@ -2469,7 +2469,7 @@ again:
   fp = ifp;
   lineptr = linebuf + LINELEN;
   startline = inclstack[inclev].lineno;
-  if ((c = getc(fp)) == EOF) {
+  if ((c = FE_GETC(fp)) == EOF) {
     if (inclev <= 0)
       return (EOF);
     fclose(ifp);
@@ -2493,7 +2493,7 @@ joinlines:
   isquest = 0;
   while (i < LINELEN - 2 && c != EOF && c != '\n') {
     *p++ = c;
-    c = getc(fp);
+    c = FE_GETC(fp);
     ++i;
   }
   if (c != '\n' && c != EOF && i >= LINELEN - 2) {
@@ -2536,7 +2536,7 @@ joinlines:
   if (dojoin) {
     firstime = 0;
     savestart = start;
-    c = getc(fp);
+    c = FE_GETC(fp);
     goto joinlines;
   }
   return *lineptr++;
@@ -118,6 +118,7 @@ static int inline_reduction_craft(int, int, int);
 static void nop_dealloc(int, int);
 static void handle_shift(int s);
 static LOGICAL contains_any_call(int astx);
+static LOGICAL small_matmul_candidate(int);
 
 
 /*------ Argument & Expression Rewriting ----------*/
@@ -4132,9 +4133,14 @@ rewrite_asn(int ast, int std, bool flag, int lc)
           goto rewrite_this; /* vector subscript */
     }
     /* Otherwise, we can use lhs directly */
-    args = rewrite_sub_args(rhs, lc);
-    A_ARGSP(rhs, args);
-    new_rhs = inline_reduction_f90(rhs, lhs, lc, &doremove);
+    new_rhs = rhs;
+    if (small_matmul_candidate(rhs))
+      new_rhs = inline_reduction_f90(rhs, lhs, lc, &doremove);
+    if (new_rhs == rhs) {
+      args = rewrite_sub_args(rhs, lc);
+      A_ARGSP(rhs, args);
+      new_rhs = inline_reduction_f90(rhs, lhs, lc, &doremove);
+    }
     if (new_rhs == rhs) {
       new_rhs = rewrite_func_ast(rhs, args, lhs);
       doremove = new_rhs == 0;
@@ -5815,26 +5821,113 @@ build_array_ref(int inast, int si, int vi, int sj, int vj)
 
 } /* build_array_ref */
 
+/* limits for expanding MATMUL and DOT_PRODUCT of constant shape inline */
+#define SMALL_MM_EXTENT 4 /* in each dimension */
+#define SMALL_MM_WORK 64  /* multiply-adds */
+
+static int small_mm_sptr;
+
+static LOGICAL
+_small_mm_uses(int ast, LOGICAL *pflag)
+{
+  if (A_TYPEG(ast) == A_ID && A_SPTRG(ast) == small_mm_sptr) {
+    *pflag = TRUE;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/*
+ * Can the expanded matmul store straight into dest?  dest must be a plain
+ * array (or section of one) that neither argument refers to, and that no
+ * pointer, EQUIVALENCE or COMMON block can reach.
+ */
+static LOGICAL
+small_matmul_use_dest(int dest, int arg1, int arg2, int rank, int elem_dty)
+{
+  LOGICAL uses = FALSE;
+
+  if (!matmul_use_lhs(dest, rank, elem_dty) || dest != arg_gbl.lhs)
+    return FALSE;
+  if (A_TYPEG(dest) == A_SUBSCR)
+    dest = A_LOPG(dest);
+  if (A_TYPEG(dest) != A_ID)
+    return FALSE;
+  small_mm_sptr = A_SPTRG(dest);
+  if (POINTERG(small_mm_sptr) || TARGETG(small_mm_sptr) ||
+      ALLOCATTRG(small_mm_sptr) || SOCPTRG(small_mm_sptr) ||
+      SCG(small_mm_sptr) == SC_CMBLK)
+    return FALSE;
+  ast_visit(1, 1);
+  ast_traverse(arg1, _small_mm_uses, NULL, &uses);
+  ast_traverse(arg2, _small_mm_uses, NULL, &uses);
+  ast_unvisit();
+  return !uses;
+}
+
+/*
+ * If arg is transpose(b) and b has no calls, return b and flip *trans, so
+ * the expansion can index b with its subscripts swapped instead of forming
+ * the transpose in a temp.
+ */
+static int
+small_matmul_arg(int arg, LOGICAL *trans)
+{
+  int inner;
+
+  if (arg && A_TYPEG(arg) == A_INTR && A_OPTYPEG(arg) == I_TRANSPOSE) {
+    inner = ARGT_ARG(A_ARGSG(arg), 0);
+    if (!contains_any_call(inner)) {
+      *trans = !*trans;
+      return inner;
+    }
+  }
+  return arg;
+}
+
+/*
+ * Is ast a matmul whose arguments, apart from transposes, need no
+ * rewriting?  Such a matmul can be offered to inline_small_matmul before
+ * its arguments are evaluated into temps.
+ */
+static LOGICAL
+small_matmul_candidate(int ast)
+{
+  LOGICAL trans = FALSE;
+  int args, arg1, arg2;
+
+  if (A_TYPEG(ast) != A_INTR ||
+      (A_OPTYPEG(ast) != I_MATMUL && A_OPTYPEG(ast) != I_MATMUL_TRANSPOSE))
+    return FALSE;
+  args = A_ARGSG(ast);
+  arg1 = small_matmul_arg(ARGT_ARG(args, 0), &trans);
+  arg2 = small_matmul_arg(ARGT_ARG(args, 1), &trans);
+  return arg1 && arg2 && !contains_any_call(arg1) && !contains_any_call(arg2);
+}
+
 /*
  *  a = matmul( b, c )
- *  where the extent of a, b, c is less than 3 in each dimension
+ *  where the extent of a, b, c is at most SMALL_MM_EXTENT in each dimension
  *  inline to
  *   a(i,j) = sum(b(i,k) * c(k,j))
  *  where we expand i, j, k at compile time from 1 to the extent.
  *  for I_MATMUL_TRANSPOSE, we transpose the first argument:
  *   a(i,j) = sum(b(k,i) * c(k,j))
- *  if dest is zero, we have to create a temp array of the appropriate size
- *  and return a reference to that array.
+ *  if dest is zero, or might overlap b or c, we have to create a temp array
+ *  of the appropriate size and return a reference to that array.  Otherwise
+ *  the elements are stored into dest directly, *doremove is set, and dest
+ *  is returned.
  */
 
 static int
-inline_small_matmul(int ast, int dest)
+inline_small_matmul(int ast, int dest, LOGICAL *doremove)
 {
   ISZ_T ilow, ihigh, istride, iextent;
   ISZ_T jlow, jhigh, jstride, jextent;
   ISZ_T klow, khigh, kstride, kextent;
   ISZ_T klowx, khighx, kstridex, kextentx;
-  int ii, kk;
+  int ii, kk, kk2, jj2;
+  LOGICAL trans1, trans2;
   int args, arg1, arg2, array1, array2, arraydest;
   int shape1, shape2;
   int stdnext, lineno;
@@ -5849,6 +5942,10 @@ inline_small_matmul(int ast, int dest)
   arg2 = ARGT_ARG(args, 1);
   if (!arg1 || !arg2)
     return ast;
+  trans1 = A_OPTYPEG(ast) == I_MATMUL_TRANSPOSE;
+  trans2 = FALSE;
+  arg1 = small_matmul_arg(arg1, &trans1);
+  arg2 = small_matmul_arg(arg2, &trans2);
 
   stdprev = STD_PREV(arg_gbl.std);
   arg1 = rewrite_scalar_functions(arg1, arg_gbl.std);
@@ -5872,8 +5969,11 @@ inline_small_matmul(int ast, int dest)
      */
     int argtnew, astnew;
     argtnew = mk_argt(2);
+    /* a peeled transpose had no calls, so its argument is unchanged */
     ARGT_ARG(argtnew, 0) = arg1;
-    ARGT_ARG(argtnew, 1) = arg2;
+    if (trans1 != (A_OPTYPEG(ast) == I_MATMUL_TRANSPOSE))
+      ARGT_ARG(argtnew, 0) = ARGT_ARG(args, 0);
+    ARGT_ARG(argtnew, 1) = trans2 ? ARGT_ARG(args, 1) : arg2;
     astnew = mk_func_node(A_TYPEG(ast), A_LOPG(ast), 2, argtnew);
     A_OPTYPEP(astnew, A_OPTYPEG(ast));
     A_SHAPEP(astnew, A_SHAPEG(ast));
@@ -5889,13 +5989,19 @@ inline_small_matmul(int ast, int dest)
     return ast;
   if (SHD_NDIM(shape1) == 1 && SHD_NDIM(shape2) == 1)
     return ast;
-  /* check for transposed 1st argument */
+  /* check for transposed arguments */
   ii = 0;
   kk = 1;
-  if (A_OPTYPEG(ast) == I_MATMUL_TRANSPOSE) {
+  if (trans1) {
     ii = 1;
     kk = 0;
   }
+  kk2 = 0;
+  jj2 = 1;
+  if (trans2) {
+    kk2 = 1;
+    jj2 = 0;
+  }
   /* the shapes must be constant sizes */
   if (SHD_NDIM(shape1) == 1) {
     ilow = 0;
@@ -5934,17 +6040,17 @@ inline_small_matmul(int ast, int dest)
     if (!ast_cval(SHD_STRIDE(shape2, 0), &kstridex))
       return ast;
   } else {
-    if (!ast_cval(SHD_LWB(shape2, 0), &klowx))
+    if (!ast_cval(SHD_LWB(shape2, kk2), &klowx))
       return ast;
-    if (!ast_cval(SHD_UPB(shape2, 0), &khighx))
+    if (!ast_cval(SHD_UPB(shape2, kk2), &khighx))
       return ast;
-    if (!ast_cval(SHD_STRIDE(shape2, 0), &kstridex))
+    if (!ast_cval(SHD_STRIDE(shape2, kk2), &kstridex))
       return ast;
-    if (!ast_cval(SHD_LWB(shape2, 1), &jlow))
+    if (!ast_cval(SHD_LWB(shape2, jj2), &jlow))
       return ast;
-    if (!ast_cval(SHD_UPB(shape2, 1), &jhigh))
+    if (!ast_cval(SHD_UPB(shape2, jj2), &jhigh))
       return ast;
-    if (!ast_cval(SHD_STRIDE(shape2, 1), &jstride))
+    if (!ast_cval(SHD_STRIDE(shape2, jj2), &jstride))
       return ast;
   }
   if (istride == 0 || kstride == 0 || kstridex == 0 || jstride == 0)
@@ -5957,20 +6063,25 @@ inline_small_matmul(int ast, int dest)
     return ast;
 
   /* See if it's small enough */
-  if (iextent <= 0 || iextent > 4)
+  if (iextent <= 0 || iextent > SMALL_MM_EXTENT)
+    return ast;
+  if (jextent <= 0 || jextent > SMALL_MM_EXTENT)
     return ast;
-  if (jextent <= 0 || jextent > 4)
+  if (kextent <= 0 || kextent > SMALL_MM_EXTENT)
     return ast;
-  if (kextent <= 0 || kextent > 4)
+  if (iextent * jextent * kextent > SMALL_MM_WORK)
     return ast;
-  if (iextent * jextent * kextent > 32)
+  if (!TY_ISLOG(DTYG(A_DTYPEG(ast))) && !TY_ISNUMERIC(DTYG(A_DTYPEG(ast))))
     return ast;
 
   array1 = convert_subscript_in_expr(arg1);
   array2 = convert_subscript_in_expr(arg2);
   stdnext = arg_gbl.std;
   lineno = STD_LINENO(stdnext);
-  if (1 || !dest) {
+  if (!doremove ||
+      !small_matmul_use_dest(dest, arg1, arg2, SHD_NDIM(A_SHAPEG(ast)),
+                             DDTG(A_DTYPEG(ast)))) {
+    doremove = NULL;
     int sptr, dtnew, eldtype;
     ADSC *ad;
     eldtype = DDTG(A_DTYPEG(ast));
@@ -6006,8 +6117,6 @@ inline_small_matmul(int ast, int dest)
   if (TY_ISLOG(DTYG(A_DTYPEG(ast)))) {
     mulop = OP_LAND;
     addop = OP_LOR;
-  } else if (!TY_ISNUMERIC(DTYG(A_DTYPEG(ast)))) {
-    return ast;
   }
   /* build assignment statements */
   for (j = 0; j < jextent; ++j) {
@@ -6026,7 +6135,7 @@ inline_small_matmul(int ast, int dest)
         opnd1 = build_array_ref(array1, ii, i, kk, k);
         if (opnd1 == 0)
           return ast;
-        opnd2 = build_array_ref(array2, 0, k, 1, j);
+        opnd2 = build_array_ref(array2, kk2, k, jj2, j);
         if (opnd2 == 0)
           return ast;
         opnd1 = mk_binop(mulop, opnd1, opnd2, A_DTYPEG(opnd1));
@@ -6045,10 +6154,86 @@ inline_small_matmul(int ast, int dest)
       STD_KERNEL(std) = STD_KERNEL(stdnext);
     }
   }
+  if (doremove) {
+    *doremove = TRUE;
+    return dest;
+  }
   /* return the destination array */
   return arraydest;
 } /* inline_small_matmul */
 
+/*
+ *  dot_product( b, c )
+ *  where b and c have a constant extent of at most SMALL_MM_EXTENT
+ *  inline to the expression
+ *   b(1)*c(1) + b(2)*c(2) + ...
+ *  Complex arguments are left to the reduction loop, which conjugates b.
+ *  Return 0 if the call can't be expanded.
+ */
+static int
+inline_small_dot_product(int ast)
+{
+  ISZ_T low, high, stride, extent, lowx, highx, stridex;
+  int args, arg1, arg2, array1, array2;
+  int shape1, shape2;
+  int dtype, k, rhs;
+  int mulop, addop;
+
+  if (XBIT(47, 0x200))
+    return 0;
+  dtype = A_DTYPEG(ast);
+  if (TY_ISLOG(DTY(dtype))) {
+    mulop = OP_LAND;
+    addop = OP_LOR;
+  } else if (TY_ISNUMERIC(DTY(dtype)) && !DT_ISCMPLX(dtype)) {
+    mulop = OP_MUL;
+    addop = OP_ADD;
+  } else {
+    return 0;
+  }
+  args = A_ARGSG(ast);
+  arg1 = ARGT_ARG(args, 0);
+  arg2 = ARGT_ARG(args, 1);
+  if (!arg1 || !arg2 || contains_any_call(arg1) || contains_any_call(arg2))
+    return 0;
+  shape1 = A_SHAPEG(arg1);
+  shape2 = A_SHAPEG(arg2);
+  if (!shape1 || !shape2 || SHD_NDIM(shape1) != 1 || SHD_NDIM(shape2) != 1)
+    return 0;
+  if (!ast_cval(SHD_LWB(shape1, 0), &low) ||
+      !ast_cval(SHD_UPB(shape1, 0), &high) ||
+      !ast_cval(SHD_STRIDE(shape1, 0), &stride) ||
+      !ast_cval(SHD_LWB(shape2, 0), &lowx) ||
+      !ast_cval(SHD_UPB(shape2, 0), &highx) ||
+      !ast_cval(SHD_STRIDE(shape2, 0), &stridex))
+    return 0;
+  if (stride == 0 || stridex == 0)
+    return 0;
+  extent = (high - low + stride) / stride;
+  if (extent != (highx - lowx + stridex) / stridex)
+    return 0;
+  if (extent <= 0 || extent > SMALL_MM_EXTENT)
+    return 0;
+
+  array1 = convert_subscript_in_expr(arg1);
+  array2 = convert_subscript_in_expr(arg2);
+  rhs = 0;
+  for (k = 0; k < extent; ++k) {
+    int opnd1, opnd2;
+    opnd1 = build_array_ref(array1, 0, k, 1, 0);
+    opnd2 = build_array_ref(array2, 0, k, 1, 0);
+    if (opnd1 == 0 || opnd2 == 0)
+      return 0;
+    if (A_DTYPEG(opnd1) != dtype)
+      opnd1 = mk_convert(opnd1, dtype);
+    if (A_DTYPEG(opnd2) != dtype)
+      opnd2 = mk_convert(opnd2, dtype);
+    opnd1 = mk_binop(mulop, opnd1, opnd2, dtype);
+    rhs = rhs ? mk_binop(addop, rhs, opnd1, dtype) : opnd1;
+  }
+  return rhs;
+} /* inline_small_dot_product */
+
 static int
 inline_reduction_f90(int ast, int dest, int lc, LOGICAL *doremove)
 {
@@ -6116,7 +6301,6 @@ inline_reduction_f90(int ast, int dest, int lc, LOGICAL *doremove)
   case I_IPARITY:      // AOCC
   case I_PARITY:       // AOCC
   case I_COUNT:
-  case I_DOT_PRODUCT:
   case I_MAXVAL:
   case I_MINVAL:
   case I_PRODUCT:
@@ -6124,6 +6308,16 @@ inline_reduction_f90(int ast, int dest, int lc, LOGICAL *doremove)
     if (doremove)
       *doremove = TRUE;
     break;
+  case I_DOT_PRODUCT:
+    newast = inline_small_dot_product(ast);
+    if (newast) {
+      if (doremove)
+        *doremove = FALSE;
+      return newast;
+    }
+    if (doremove)
+      *doremove = TRUE;
+    break;
   case I_MAXLOC:
       return ast;
   case I_MINLOC:
@@ -6139,7 +6333,7 @@ inline_reduction_f90(int ast, int dest, int lc, LOGICAL *doremove)
   case I_MATMUL_TRANSPOSE:
     if (doremove)
       *doremove = FALSE;
-    return inline_small_matmul(ast, dest);
+    return inline_small_matmul(ast, dest, doremove);
   default:
     return ast;
   }
@@ -264,6 +264,18 @@ void lower_pstride_info(FILE *lowerfile); /* pstride.c */
 void parse_init(void);
 
 void fpp(void); /* fpp.c */
+void cpp_rewind(void); /* main.c */
+void cpp_release(void); /* main.c */
+
+/* Source and preprocessor streams are only used by the front end's single
+ * thread, so the per-character readers and writers skip stdio locking. */
+#if defined(HOST_WIN)
+#define FE_GETC(f) getc(f)
+#define FE_PUTC(c, f) putc(c, f)
+#else
+#define FE_GETC(f) getc_unlocked(f)
+#define FE_PUTC(c, f) putc_unlocked(c, f)
+#endif
 
 #if defined(HOST_WIN)
 #define snprintf _snprintf
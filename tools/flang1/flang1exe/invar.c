@@ -51,6 +51,7 @@
 #include "nme.h"
 #include "optimize.h"
 #include "semant.h"
+#include "ccffinfo.h"
 
 static LOGICAL invar_src(int);
 static void invar_init(int);
@@ -579,6 +580,9 @@ invar_motion(int std)
       hstable = is_std_hoistable(std, lpx);
       if (hstable) {
         hoist_stmt(std, LP_FG(lpx), lpx);
+        if (STD_VISIT(std))
+          ccff_info(MSGOPT, "OPT053", 1, STD_LINENO(std),
+                    "Array temp allocation hoisted out of loop", NULL);
       } else {
         /* mark not hoistable so that the deallocate will not be hoist */
         astd = STD_HSTBLE(std);
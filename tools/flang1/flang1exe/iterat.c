@@ -226,6 +226,7 @@ static struct {
   int dsize, davl;
   int estdx, dstdx;
   int dexpr, forall_list;
+  LOGICAL sequential; /* forall runs as a DO nest in triplet order */
 } dep = {NULL, 0};
 
 /*
@@ -427,12 +428,13 @@ name_dependent_check(int expr)
             }
           }
           if (overlap == 1 && dep.forall_list) {
-            /* allow (=,=,=) dependence */
+            /* allow (=,=,=) dependence; run in order, the reference is
+             * only a problem if it reads what an earlier iteration stored */
             if (dep.dexpr == expr) {
               overlap = 0;
               /* check subscripts, if any */
             } else if (!dd_array_conflict(A_LISTG(dep.forall_list), dep.dexpr,
-                                          expr, -1)) {
+                                          expr, dep.sequential ? 0 : -1)) {
               overlap = 0;
             } else {
               /* flg.depchk MORE WORK HERE */
@@ -651,6 +653,27 @@ is_dependent(int lhs, int rhs, int forall, int lstdx, int rstdx)
   return expr_dependent_check(rhs);
 } /* is_dependent */
 
+/*
+ * Like is_dependent, but for the forall executed as a DO nest over its
+ * triplets, in the order they are written: only a reference in rhs that
+ * may read an element of lhs stored by an earlier iteration is a
+ * dependence.  Reading an element before a later iteration overwrites it
+ * is the FORALL semantics, so no temp is needed for that.
+ */
+LOGICAL
+is_sequential_dependent(int lhs, int rhs, int forall, int lstdx, int rstdx)
+{
+  LOGICAL l;
+
+  if (rhs == 0)
+    return FALSE;
+  build_dlist(lhs, forall, lstdx, rstdx);
+  dep.sequential = TRUE;
+  l = expr_dependent_check(rhs);
+  dep.sequential = FALSE;
+  return l;
+} /* is_sequential_dependent */
+
 LOGICAL
 subscr_dependent(int expr, int depends, int lstdx, int rstdx)
 {
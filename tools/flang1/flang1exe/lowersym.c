@@ -147,9 +147,10 @@ lower_set_symbols(void)
     case ST_MEMBER:
     case ST_DESCRIPTOR:
       if (!IGNOREG(sptr) && DTY(DTYPEG(sptr)) == TY_ARRAY) {
-        if ((!TARGETG(sptr) && !POINTERG(sptr) &&
-             (ALLOCG(sptr) || !ADDRTKNG(sptr))) ||
-            CCSYMG(sptr) || HCCSYMG(sptr)) {
+        if (((!TARGETG(sptr) && !POINTERG(sptr) &&
+              (ALLOCG(sptr) || !ADDRTKNG(sptr))) ||
+             CCSYMG(sptr) || HCCSYMG(sptr)) &&
+            !PTRVIEWG(sptr)) {
           VISIT2P(sptr, 1);
         }
       }
@@ -3800,8 +3801,9 @@ lower_symbol(int sptr)
     putbit("devicesd", 0);
     putval("devcopy", 0);
     putbit("allocattr", ALLOCATTRG(sptr));
-    putbit("f90pointer", 0); /* F90POINTER will denote the POINTER attribute */
-                             /* but first need to remove FE legacy use */
+    /* F90POINTER will denote the POINTER attribute, but first need to
+     * remove FE legacy use; for now it only marks unit-stride views */
+    putbit("f90pointer", PTRVIEWG(sptr));
     putbit("procdescr", IS_PROC_DESCRG(sptr));
     strip = 1;
     break;
@@ -108,6 +108,15 @@ static char *who[] = {"init",     "parser",   "bblock", "vectorize", "optimize",
 #define _N_WHO (sizeof(who) / sizeof(char *))
 static INT xtimes[_N_WHO];
 static LOGICAL postprocessing = TRUE;
+
+/* Source file buffer; the scanner reads the whole file through it */
+#define SRC_BUFSIZE (1 << 18)
+static char src_buf[SRC_BUFSIZE];
+
+/* Preprocessor output collected in memory, see cpp_rewind() */
+static char *cpp_buf = NULL;
+static size_t cpp_size = 0;
+static LOGICAL cpp_in_memory = FALSE;
 char *flang_version_sha = {FLANG_SHA};
 //char *flang_version_sha[] = {FLANG_SHA};
 
@@ -165,6 +174,49 @@ static int dodebug = 0;
 
 #define NO_FLEXLM
 
+/** \brief Position gbl.cppfil at the start of the preprocessor output.
+
+    Called by the preprocessor when it is done.  Output collected in memory
+    is handed to the scanner as a read-only stream over the same buffer, so
+    it is never written to and read back from a temporary file.
+ */
+void
+cpp_rewind(void)
+{
+#if !defined(TARGET_WIN)
+  FILE *fil;
+
+  if (cpp_in_memory) {
+    cpp_in_memory = FALSE;
+    /* closing the stream finalizes cpp_buf and cpp_size */
+    fclose(gbl.cppfil);
+    if (cpp_size != 0 && (fil = fmemopen(cpp_buf, cpp_size, "r")) != NULL) {
+      gbl.cppfil = fil;
+      return;
+    }
+    /* empty output: fmemopen may reject a zero-sized buffer */
+    if ((gbl.cppfil = tmpf("a")) == NULL)
+      errfatal(5);
+    fwrite(cpp_buf, 1, cpp_size, gbl.cppfil);
+    cpp_release();
+  }
+#endif
+  (void)fseek(gbl.cppfil, 0L, 0);
+}
+
+/** \brief Free the preprocessor output kept in memory by cpp_rewind().
+
+    Called by the scanner when it closes the main input stream, which is
+    the only reader of the buffer.
+ */
+void
+cpp_release(void)
+{
+  free(cpp_buf); /* allocated by open_memstream */
+  cpp_buf = NULL;
+  cpp_size = 0;
+}
+
 /** \brief Fortran front-end main entry
     \param argc number of command-line arguments
     \pram argv array of command-line argument strings
@@ -504,6 +556,10 @@ main(int argc, char *argv[])
           redundss();
           DUMP("redundss");
         }
+        if (flg.opt >= 2 && !XBIT(47, 0x40)) {
+          unit_stride_versioning();
+          DUMP("unitstride");
+        }
         if (flg.opt >= 2 && !XBIT(47, 0x1000)) {
           TR(DNAME " OPTIMIZER begins\n");
           optimize(0);
@@ -1150,6 +1206,7 @@ init(int argc, char *argv[])
     /* not found */
     error(2, 4, 0, sourcefile, CNULL);
     is_open:
+    setvbuf(gbl.srcfil, src_buf, _IOFBF, SRC_BUFSIZE);
     if (preproc == 1)
       fpp_ = TRUE; /* -preproc forces preprocessing */
   }
@@ -1256,8 +1313,13 @@ init(int argc, char *argv[])
           else if ((gbl.cppfil = fopen(cppfile, "w")) == NULL)
             errfatal(5);
         } else {
-          if ((gbl.cppfil = tmpf("a")) == NULL)
-            errfatal(5);
+#if !defined(TARGET_WIN)
+          gbl.cppfil = open_memstream(&cpp_buf, &cpp_size);
+          cpp_in_memory = gbl.cppfil != NULL;
+          if (gbl.cppfil == NULL)
+#endif
+            if ((gbl.cppfil = tmpf("a")) == NULL)
+              errfatal(5);
         }
         fpp();
         if (flg.es || gbl.maxsev >= 3)
@@ -34,8 +34,10 @@
 #include "state.h"
 #include "lz.h"
 #include "dbg_out.h"
+#include <unistd.h>
 
 #define MOD_SUFFIX ".mod"
+#define MOD_HASH_TAG " H" /* interface hash field on line 2 of a .mod */
 
 /* ModuleId is an index into usedb.base[] */
 typedef enum {
@@ -106,6 +108,8 @@ static void fix_module_common(void);
 static void export_public_used_modules(int scopelevel);
 static void add_to_common(int cmidx, int mem, int atstart);
 static void export_all(void);
+static void close_module_file(void);
+static void discard_module_file(void);
 static void make_rte_descriptor(int obj, char *suffix);
 static SPTR get_submod_sym(SPTR ancestor_module, SPTR submodule);
 static void dbg_dump(const char *, int);
@@ -1050,6 +1054,8 @@ close_module(void)
 
 static int modu_sym = 0;
 static FILE *outfile;
+static char *outfile_name = NULL;    /* the .mod file being produced */
+static char *outfile_tmpname = NULL; /* where outfile is actually written */
 static FILE *single_outfile = NULL;
 static char *single_outfile_name = NULL;
 static char *single_outfile_index_name = NULL;
@@ -1256,10 +1262,8 @@ end_module(void)
   if (sem.mod_cnt == 2)
     FREE(impl.base);
   if (modu_sym == 0) {
-    if (outfile != NULL && sem.mod_cnt == 2) {
-      fclose(outfile);
-      outfile = NULL;
-    }
+    if (outfile != NULL && sem.mod_cnt == 2)
+      close_module_file();
     goto exit;
   }
   export_public_used_modules(sem.scope_level);
@@ -1290,10 +1294,8 @@ end_module(void)
   if (seen_contains)
     gbl.currsub = 0;
 
-  if (outfile != NULL && sem.mod_cnt == 2) {
-    fclose(outfile);
-    outfile = NULL;
-  }
+  if (outfile != NULL && sem.mod_cnt == 2)
+    close_module_file();
   if (sem.which_pass == 0 && ((XBIT(123, 2) || XBIT(123, 8)))) {
     if (gbl.moddependfil == NULL) {
       if ((gbl.moddependfil = tmpf("a")) == NULL)
@@ -1999,9 +2001,16 @@ export_all(void)
   }
   convert_2dollar_signs_to_hyphen(t_nm);
   strcat(t_nm, MOD_SUFFIX);
-  outfile = fopen(t_nm, "w+");
+  /* Export to a scratch file; close_module_file() decides whether it
+   * replaces the existing .mod file. */
+  discard_module_file(); /* left by the first pass over a CONTAINS module */
+  outfile_name = t_nm;
+  outfile_tmpname = getitem(8, strlen(t_nm) + 24);
+  sprintf(outfile_tmpname, "%s.%ld.tmp", t_nm, (long)getpid());
+  outfile = fopen(outfile_tmpname, "w+");
   if (outfile == NULL) {
     error(4, 0, gbl.lineno, "Unable to create MODULE file", t_nm);
+    outfile_tmpname = NULL;
     return;
   }
   if (sem.mod_dllexport) {
@@ -2036,13 +2045,224 @@ export_all(void)
   dbg_dump("export_all", 0x1000);
 }
 
+/* Close and remove the scratch file of an unfinished export, if any. */
+static void
+discard_module_file(void)
+{
+  if (outfile != NULL) {
+    fclose(outfile);
+    outfile = NULL;
+  }
+  if (outfile_tmpname != NULL) {
+    unlink(outfile_tmpname);
+    outfile_tmpname = NULL;
+  }
+}
+
+/* FNV-1a over a byte range, continuing from hash h. */
+static BIGUINT64
+mod_hash_bytes(BIGUINT64 h, const char *p, size_t n)
+{
+  while (n--) {
+    h ^= (unsigned char)*p++;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+/*
+ * Hash one record of an exported module, p..eol, leaving out the fields
+ * that only locate it in the source: the line number of every symbol,
+ * the first and last lines of subprograms, modules, constructs and blocks,
+ * and the line numbers of equivalences, namelists and data initializations.  Editing the body of a module procedure moves these
+ * without changing the interface.
+ */
+static BIGUINT64
+mod_hash_record(BIGUINT64 h, const char *p, const char *eol)
+{
+  const char *t;
+  int i, b, stype, skip1, skip2, skip3;
+  int lead[16];
+
+  b = -1;
+  stype = -1;
+  skip1 = skip2 = skip3 = -1;
+  switch (*p) {
+  case 'J':
+    skip1 = 1;
+    break;
+  case 'E':
+  case 'N':
+    skip1 = 2;
+    break;
+  }
+  for (i = 0; p < eol; ++i) {
+    for (t = p; t < eol && *t != ' '; ++t)
+      ;
+    if (i < 16)
+      lead[i] = atoi(p);
+    if (*p == 'S' && i == 0) {
+      b = 0;
+    } else if (b == 0 && t - p == 1 && *p == 'A') {
+      /* the stype precedes the ten fields up to the A marker */
+      stype = i >= 10 && i - 10 < 16 ? lead[i - 10] : -1;
+    } else if (b == 0 && t - p == 1 && *p == 'B') {
+      b = i;
+      skip1 = b + 2; /* lineno */
+      switch (stype) {
+      case ST_ENTRY:
+      case ST_PROC:
+      case ST_MODULE:
+        skip2 = b + 13; /* ENDLINE */
+        skip3 = b + 22; /* FUNCLINE */
+        break;
+      case ST_CONSTRUCT:
+        skip3 = b + 22; /* FUNCLINE */
+        break;
+      case ST_BLOCK:
+        skip2 = b + 9;  /* STARTLINE */
+        skip3 = b + 13; /* ENDLINE */
+        break;
+      }
+    }
+    if (i != skip1 && i != skip2 && i != skip3)
+      h = mod_hash_bytes(h, p, t - p);
+    h = mod_hash_bytes(h, " ", 1);
+    p = t < eol ? t + 1 : eol;
+  }
+  return mod_hash_bytes(h, "\n", 1);
+}
+
+/* Return the interface hash recorded in an existing .mod file, or 0. */
+static BIGUINT64
+read_module_hash(const char *name)
+{
+  FILE *fd;
+  char line[1024];
+  char *p;
+  BIGUINT64 h = 0;
+
+  fd = fopen(name, "r");
+  if (fd == NULL)
+    return 0;
+  if (fgets(line, sizeof(line), fd) && fgets(line, sizeof(line), fd)) {
+    /* the hash is the last field of the line */
+    p = strrchr(line, ' ');
+    if (p && strncmp(p, MOD_HASH_TAG, strlen(MOD_HASH_TAG)) == 0)
+      h = strtoull(p + strlen(MOD_HASH_TAG), NULL, 16);
+  }
+  fclose(fd);
+  return h;
+}
+
+/*
+ * Finish the .mod file exported by export_all().
+ *
+ * The interface hash covers everything in the exported file (symbols, data
+ * types, generics, contained subprograms) except the source file name on
+ * the second header line, the time stamp line that follows it, and the
+ * source line numbers left out by mod_hash_record().  If the existing .mod
+ * file carries the same
+ * hash, it is left untouched so that its time stamp does not trigger
+ * recompilation of the files that USE the module.  Otherwise the file is
+ * written with the hash appended to its second header line, where build
+ * tools can read it.
+ */
+static void
+close_module_file(void)
+{
+  FILE *fd;
+  char *buf;
+  long len, n;
+  char *l2, *l3, *p, *eol;
+  BIGUINT64 h;
+
+  fclose(outfile);
+  outfile = NULL;
+  if (outfile_tmpname == NULL)
+    return;
+
+  fd = fopen(outfile_tmpname, "r");
+  if (fd == NULL)
+    goto fail;
+  fseek(fd, 0L, SEEK_END);
+  len = ftell(fd);
+  fseek(fd, 0L, SEEK_SET);
+  NEW(buf, char, len + 1);
+  len = fread(buf, 1, len, fd);
+  fclose(fd);
+  buf[len] = '\0';
+
+  l2 = strchr(buf, '\n');
+  l3 = l2 ? strchr(l2 + 1, '\n') : NULL;
+  if (l3 == NULL) {
+    FREE(buf);
+    goto fail;
+  }
+  ++l2;
+  ++l3;
+  h = mod_hash_bytes(0xcbf29ce484222325ULL, buf, l2 - buf);
+  /* line 2 starts with the length of the source file name and the name */
+  p = l2;
+  n = strtol(p, &p, 10);
+  if (*p == ' ' && n >= 0 && n < l3 - p)
+    p += n + 1;
+  h = mod_hash_bytes(h, p, l3 - p);
+  p = strchr(l3, '\n');
+  for (p = p ? p + 1 : buf + len; p < buf + len; p = eol + 1) {
+    eol = strchr(p, '\n');
+    if (eol == NULL)
+      eol = buf + len;
+    h = mod_hash_record(h, p, eol);
+  }
+  if (h == 0)
+    h = 1;
+
+  if (!XBIT(55, 0x01) && read_module_hash(outfile_name) == h) {
+    FREE(buf);
+    unlink(outfile_tmpname);
+    outfile_tmpname = NULL;
+    return;
+  }
+
+  /* Rewrite the scratch file with the hash and rename it over the .mod
+   * file, so that a concurrent USE never sees a partly written module. */
+  fd = fopen(outfile_tmpname, "w");
+  if (fd == NULL) {
+    FREE(buf);
+    goto fail;
+  }
+  fwrite(buf, 1, l3 - buf - 1, fd);
+  fprintf(fd, "%s%016llx\n", MOD_HASH_TAG, (unsigned long long)h);
+  fwrite(l3, 1, buf + len - l3, fd);
+  FREE(buf);
+  if (fclose(fd) != 0)
+    goto fail;
+#if defined(HOST_WIN)
+  /* rename() does not replace an existing file on Windows */
+  unlink(outfile_name);
+#endif
+  if (rename(outfile_tmpname, outfile_name) != 0)
+    goto fail;
+  outfile_tmpname = NULL;
+  return;
+
+fail:
+  error(4, 0, gbl.lineno, "Unable to create MODULE file", outfile_name);
+  unlink(outfile_tmpname);
+  outfile_tmpname = NULL;
+}
+
 /*
+ * remove a scratch .mod file left by an unfinished export
  * close the single-output combined .mod file
  * write the combined .mod index file, if we're supposed to
  */
 void
 mod_fini(void)
 {
+  /* a fatal error can end the compile while a module is being exported */
+  discard_module_file();
   if (single_outfile) {
     fclose(single_outfile);
     if (single_outfile_index_name) {
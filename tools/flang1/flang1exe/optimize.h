@@ -805,6 +805,7 @@ void sectinline(void);                         /* outconv.c */
 void linearize_arrays(void);                   /* outconv.c */
 void hoist_stmt(int std, int fg, int l);       /* outconv.c */
 void redundss(void);                           /* redundss.c */
+void unit_stride_versioning(void);             /* unitstride.c */
 
 /* ipa.c */
 extern int IPA_Vestigial;
@@ -67,7 +67,9 @@ static void find_stmt_calls_pos(int forall, int mask_pos);
 static int find_max_of_mask_calls_pos(int forall);
 static void add_mask_calls(int pos, int forall, int stdnext);
 static void add_stmt_calls(int pos, int forall, int stdnext);
-static void forall_dependency(int std);
+static void forall_dependency(int std, LOGICAL inorder);
+static LOGICAL inorder_dependent(int std, int forall, int lhs, int rhs);
+static LOGICAL forall_inorder(int std, int forall, int lhs, int rhs);
 static void put_calls(int pos, int std, int stdnext);
 static void search_pure_function(int stdfirst, int stdlast);
 static int transform_pure_function(int expr, int std);
@@ -154,13 +156,21 @@ forall_dependency_analyze(void)
   int ast;
   int parallel_depth;
   int task_depth;
+  int wrkshr_depth;
 
   templist = NULL;
   parallel_depth = 0;
   task_depth = 0;
+  wrkshr_depth = 0;
   for (std = STD_NEXT(0); std;) {
     ast = STD_AST(std);
     switch (A_TYPEG(ast)) {
+    case A_MP_WORKSHARE:
+      ++wrkshr_depth;
+      break;
+    case A_MP_ENDWORKSHARE:
+      --wrkshr_depth;
+      break;
     case A_MP_PARALLEL:
       ++parallel_depth;
       set_descriptor_sc(SC_PRIVATE);
@@ -189,7 +199,9 @@ forall_dependency_analyze(void)
         std = STD_NEXT(std);
         continue;
       }
-      forall_dependency(std);
+      /* the iterations of a forall in a workshare may be split across the
+       * team, so they cannot be relied on to run in order */
+      forall_dependency(std, wrkshr_depth == 0);
       break;
     }
     std = STD_NEXT(std);
@@ -300,6 +312,49 @@ gen_endsingle(int std, int single, int presinglebarrier)
   add_stmt_after(mk_stmt(A_MP_BARRIER, 0), ompstd);
 }
 
+/* If ast calls the serial MATMUL entry on shared user arrays, retarget it
+ * to the team-aware entry, which every thread of the team calls to compute
+ * its own block of the result, and return TRUE.
+ */
+static LOGICAL
+gen_team_intrinsic(int ast)
+{
+  static FtnRtlEnum team_rtns[] = {
+      RTE_matmul_cplx16, RTE_matmul_cplx32, RTE_matmul_cplx8,
+      RTE_matmul_int1,   RTE_matmul_int2,   RTE_matmul_int4,
+      RTE_matmul_int8,   RTE_matmul_log1,   RTE_matmul_log2,
+      RTE_matmul_log4,   RTE_matmul_log8,   RTE_matmul_real16,
+      RTE_matmul_real4,  RTE_matmul_real8,  RTE_no_rtn /* end of list */
+  };
+  int argt, sptr, i;
+  char *fname;
+
+  if (XBIT(69, 0x4000))
+    return FALSE;
+  if (A_TYPEG(ast) != A_ICALL && A_TYPEG(ast) != A_CALL)
+    return FALSE;
+  if (A_TYPEG(A_LOPG(ast)) != A_ID || A_ARGCNTG(ast) != 6)
+    return FALSE;
+  fname = SYMNAME(A_SPTRG(A_LOPG(ast)));
+  for (i = 0;; ++i) {
+    if (team_rtns[i] == RTE_no_rtn)
+      return FALSE;
+    if (strcmp(fname, mkRteRtnNm(team_rtns[i])) == 0)
+      break;
+  }
+  /* dest, s1 and s2 precede their descriptors; compiler temps and private
+   * variables are per thread */
+  argt = A_ARGSG(ast);
+  for (i = 0; i < 3; ++i) {
+    sptr = sym_of_ast(ARGT_ARG(argt, i));
+    if (CCSYMG(sptr) || HCCSYMG(sptr) || SCG(sptr) == SC_PRIVATE ||
+        THREADG(sptr))
+      return FALSE;
+  }
+  A_LOPP(ast, mk_id(sym_mkfunc(mkRteRtnNm(RTE_matmul_team), DT_NONE)));
+  return TRUE;
+}
+
 static void
 convert_omp_workshare(void)
 {
@@ -400,6 +455,16 @@ convert_omp_workshare(void)
         break;
       case A_ALLOC:
         break;
+      case A_CALL:
+      case A_ICALL:
+        if (gen_team_intrinsic(ast)) {
+          std = add_stmt_after(mk_stmt(A_MP_BARRIER, 0), std);
+          break;
+        }
+        single = mk_stmt(A_MP_SINGLE, 0);
+        add_stmt_before(single, std);
+        state = IN_SINGLE;
+        break;
       case A_ASN:
         lsptr = sym_of_ast(A_DESTG(ast));
         if (wherelevel) {
@@ -475,6 +540,15 @@ convert_omp_workshare(void)
       case A_ENDDO:
           dolevel--;
         break;
+      case A_CALL:
+      case A_ICALL:
+        if (dolevel == 0 && gen_team_intrinsic(ast)) {
+          gen_endsingle(std, single, presinglebarrier);
+          presinglebarrier = 0;
+          std = add_stmt_after(mk_stmt(A_MP_BARRIER, 0), std);
+          state = IN_WRKSHR;
+        }
+        break;
       case A_COMMENT:
         switch (A_TYPEG(A_LOPG(ast))) {
         case A_FORALL:
@@ -3863,6 +3937,9 @@ get_temp_forall2(int forall_ast, int subscr_ast, int alloc_stmt,
     if (q->std == std || q->dtype != dtype || q->cvlen != cvlen ||
         q->sc != symutl.sc || LP_PARENT(lp2) != LP_PARENT(lp))
       continue;
+    /* small temps are not allocated, see check_small_allocatable() */
+    if (!q->astd)
+      continue;
 
     if (ndim != ASD_NDIM(q->asd))
       continue;
@@ -3931,7 +4008,7 @@ new_sptr:
   if (fg)
     wrilts(fg);
 
-  if (!par) {
+  if (!par && astd) {
     STD_HSTBLE(astd) = dstd;
     STD_HSTBLE(dstd) = astd;
     if (STD_ACCEL(alloc_stmt))
@@ -3978,12 +4055,95 @@ is_pointer(int ast)
  *              forall(i=1:N) a(i) = temp(i)
  */
 
+/*
+ * Return TRUE if forall, run as a DO nest over its triplets, can read an
+ * element of lhs that an earlier iteration stored.  The dependence test
+ * and the DO nest built by conv_forall() need not agree on which triplet
+ * is outermost, so check both nestings.
+ */
+static LOGICAL
+inorder_dependent(int std, int forall, int lhs, int rhs)
+{
+  int list, li, newli, n;
+  int tl[MAXSUBS];
+  LOGICAL l;
+
+  if (is_sequential_dependent(lhs, rhs, forall, std, std))
+    return TRUE;
+  list = A_LISTG(forall);
+  if (ASTLI_NEXT(list) == 0)
+    return FALSE;
+  n = 0;
+  for (li = list; li; li = ASTLI_NEXT(li)) {
+    if (n == MAXSUBS)
+      return TRUE;
+    tl[n++] = li;
+  }
+  start_astli();
+  while (n > 0) {
+    li = tl[--n];
+    newli = add_astli();
+    ASTLI_SPTR(newli) = ASTLI_SPTR(li);
+    ASTLI_TRIPLE(newli) = ASTLI_TRIPLE(li);
+  }
+  A_LISTP(forall, ASTLI_HEAD);
+  l = is_sequential_dependent(lhs, rhs, forall, std, std);
+  A_LISTP(forall, list);
+  return l;
+}
+
+/*
+ * A forall whose only dependence is between its lhs and rhs can often run
+ * as a DO nest without the temp: either in the order written, when no
+ * iteration reads an element stored by an earlier one, or with every
+ * triplet reversed.  Return TRUE (with the triplets of forall possibly
+ * reversed) if so.
+ */
+static LOGICAL
+forall_inorder(int std, int forall, int lhs, int rhs)
+{
+  int nd, list, li, newli, triple, stride;
+
+  nd = A_OPT1G(forall);
+  if (FT_NFUSE(nd, 0) || FT_HEADER(nd) != std)
+    return FALSE;
+  if (!inorder_dependent(std, forall, lhs, rhs)) {
+    ccff_info(MSGFTN, "FTN024", 1, STD_LINENO(std),
+              "Forall executed in order: array temp eliminated", NULL);
+    return TRUE;
+  }
+
+  list = A_LISTG(forall);
+  start_astli();
+  for (li = list; li; li = ASTLI_NEXT(li)) {
+    triple = ASTLI_TRIPLE(li);
+    if (!constant_stride(A_STRIDEG(triple), &stride) ||
+        (stride != 1 && stride != -1))
+      return FALSE;
+    newli = add_astli();
+    ASTLI_SPTR(newli) = ASTLI_SPTR(li);
+    ASTLI_TRIPLE(newli) =
+        mk_triple(A_UPBDG(triple), A_LBDG(triple),
+                  mk_isz_cval(-stride, astb.bnd.dtype));
+  }
+  A_LISTP(forall, ASTLI_HEAD);
+  if (!inorder_dependent(std, forall, lhs, rhs)) {
+    ccff_info(MSGFTN, "FTN025", 1, STD_LINENO(std),
+              "Forall executed in reverse order: array temp eliminated",
+              NULL);
+    return TRUE;
+  }
+  A_LISTP(forall, list);
+  return FALSE;
+}
+
 /*
  * This routine assumes that input is block forall with an assignment
- * statement in it.
+ * statement in it.  If inorder is set, the forall may be run as a
+ * sequential loop nest in place of using a temp.
  */
 static void
-forall_dependency(int std)
+forall_dependency(int std, LOGICAL inorder)
 {
   int lhs, rhs;
   int asn;
@@ -4027,6 +4187,7 @@ forall_dependency(int std)
 
   /* forall-independent */
   lineno = STD_LINENO(std);
+  gbl.lineno = lineno;
   open_pragma(lineno);
   bIndep = XBIT(19, 0x100) != 0;
   if (bIndep) {
@@ -4084,6 +4245,12 @@ forall_dependency(int std)
     }
 
   isdepend = is_dependent(lhs, rhs, forall, std, std);
+  if (isdepend && inorder && flg.opt >= 2 && !XBIT(47, 0x400) && !par &&
+      !task && !is_stmt_call_dependent(forall, lhs) &&
+      forall_inorder(std, forall, lhs, rhs)) {
+    close_pragma();
+    return;
+  }
   if (isdepend || is_stmt_call_dependent(forall, lhs)) {
     if (flg.opt >= 2 && !XBIT(2, 0x400000)) {
       if (is_pointer(lhs) && !lhs_needtmp(lhs, rhs, std)) {
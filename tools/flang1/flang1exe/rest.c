@@ -65,6 +65,7 @@ static int mk_descr_from_section(int, DTYPE, int);
 static int need_copyout(int entry, int loc);
 static LOGICAL is_desc_needed(int, int, int);
 static LOGICAL continuous_section(int, int, int, int);
+static int runtime_contiguity_test(int);
 static int transform_all_call(int std, int ast);
 static int remove_subscript_expressions(int ast, int std, int sym);
 static void set_descr_tag(int descr, int tag, int std);
@@ -3319,7 +3320,7 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
                 NULL);
     }
   } else {
-    int cico;
+    int cico, contig, nbytes, bytes_out;
 
     cico = 0;
     /*
@@ -3327,7 +3328,14 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
      * intent(out)
      */
     cico |= 0x1;
-    tmp = make_seq_temp_array(A_SHAPEG(arr_ast), eledtype, arraysptr, 0, std);
+    /*
+     * a section that is contiguous but for strides not known until run
+     * time is passed in place when they are all 1; the tmp is then based
+     * and only allocated and copied when the test fails
+     */
+    contig = runtime_contiguity_test(arr_ast);
+    tmp = make_seq_temp_array(A_SHAPEG(arr_ast), eledtype, arraysptr,
+                              contig != 0, std);
     tmp_id = mk_id(tmp);
     /*
      * generate unconditional inline copy
@@ -3338,10 +3346,22 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
 
       /* IF( array$p .eq. 0 )THEN */
       iftest = mk_binop(OP_NE, array_ptr_ast, astb.i0, DT_LOG);
+    } else if (contig) {
+      /* contig = stride .eq. 1 .and. ... */
+      int flag = mk_id(sym_get_scalar(SYMNAME(arraysptr), "c", DT_LOG));
+      ast = mk_assn_stmt(flag, contig, DT_LOG);
+      add_stmt_before(ast, std);
+
+      /* IF( .not. contig )THEN */
+      iftest = mk_unop(OP_LNOT, flag, DT_LOG);
+    }
+    if (iftest) {
       ifast = mk_stmt(A_IFTHEN, 0);
       A_IFEXPRP(ifast, iftest);
       add_stmt_before(ifast, std);
     }
+    nbytes = mk_convert(size_ast(arraysptr, DDTG(DTYPEG(arraysptr))),
+                        astb.bnd.dtype);
     shape = A_SHAPEG(arr_ast);
     ndim = SHD_NDIM(shape);
     for (i = 0; i < ndim; ++i) {
@@ -3365,6 +3385,10 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
         astup = mk_binop(OP_DIV, astup, aststride, astb.bnd.dtype);
       }
       subscr[i] = mk_triple(astb.bnd.one, astup, 0);
+      nbytes = mk_binop(OP_MUL, nbytes,
+                        ast_intr(I_MAX, astb.bnd.dtype, 2, astup,
+                                 astb.bnd.zero),
+                        astb.bnd.dtype);
     }
     tmp_ast = mk_subscr(tmp_id, subscr, ndim, eledtype);
     if (ALLOCG(tmp)) {
@@ -3380,7 +3404,27 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
     A_IFSTMTP(forall, ast);
     A_IFEXPRP(forall, 0);
     std1 = add_stmt_before(forall, std);
-    if (XBIT(28, 0x20) && POINTERG(arraysptr) && MIDNUMG(arraysptr)) {
+    /* record the bytes copied in (and out) at this call site */
+    nbytes = mk_convert(nbytes, DT_INT8);
+    bytes_out = need_copyout(entry, loc) ? nbytes : astb.k0;
+    ast = mk_func_node(A_CALL,
+                       mk_id(sym_mkfunc_nodesc(mkRteRtnNm(RTE_copy_stat),
+                                               DT_NONE)),
+                       2, mk_argt(2));
+    ARGT_ARG(A_ARGSG(ast), 0) = nbytes;
+    ARGT_ARG(A_ARGSG(ast), 1) = bytes_out;
+    add_stmt_before(ast, std);
+    if (contig) {
+      /* ELSE; tmp$p = loc(first element) */
+      ast = mk_stmt(A_ELSE, 0);
+      add_stmt_before(ast, std);
+      ast = mk_assn_stmt(mk_id(MIDNUMG(tmp)),
+                         mk_unop(OP_LOC, first_element_from_section(arr_ast),
+                                 DT_PTR),
+                         DT_PTR);
+      add_stmt_before(ast, std);
+    }
+    if (iftest) {
       /* ENDIF */
       ifast = mk_stmt(A_ENDIF, 0);
       add_stmt_before(ifast, std);
@@ -3394,7 +3438,7 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
       transform_forall(std1, forall);
     }
 
-    if (XBIT(28, 0x20) && POINTERG(arraysptr) && MIDNUMG(arraysptr)) {
+    if (iftest) {
       /* ENDIF */
       ifast = mk_stmt(A_ENDIF, 0);
       add_stmt_after(ifast, std);
@@ -3425,9 +3469,8 @@ copy_arg_to_seq_tmp(int entry, int loc, int eledtype, int arraysptr,
       }
     }
 
-    if (XBIT(28, 0x20) && POINTERG(arraysptr) && MIDNUMG(arraysptr)) {
-      /* IF( array$p .ne. 0 )THEN */
-      iftest = mk_binop(OP_NE, array_ptr_ast, astb.i0, DT_LOG);
+    if (iftest) {
+      /* IF( array$p .ne. 0 )THEN, or IF( .not. contig )THEN */
       ifast = mk_stmt(A_IFTHEN, 0);
       A_IFEXPRP(ifast, iftest);
       add_stmt_after(ifast, std);
@@ -3874,6 +3917,55 @@ continuous_section(int entry, int arr_ast, int loc, int onlyfirst)
   return TRUE;
 }
 
+/*  For a section of a contiguous array that would obey the continuous
+ *  memory rule if its strides not known at compile time were 1, return a
+ *  logical expression testing that they are all 1; otherwise return 0.
+ *  Pointers and assumed-shape dummies, whose own storage may not be
+ *  contiguous, are not tested.
+ */
+static int
+runtime_contiguity_test(int arr_ast)
+{
+  int asd;
+  int ndims, dim;
+  int astsub, aststride;
+  int sptr;
+  int subs[MAXDIMS];
+  int test;
+
+  if (XBIT(58, 0x2000000) || A_TYPEG(arr_ast) != A_SUBSCR ||
+      A_TYPEG(A_LOPG(arr_ast)) != A_ID)
+    return 0;
+  sptr = A_SPTRG(A_LOPG(arr_ast));
+  if (POINTERG(sptr) || ASSUMSHPG(sptr) || ALIGNG(sptr))
+    return 0;
+  asd = A_ASDG(arr_ast);
+  ndims = ASD_NDIM(asd);
+  test = 0;
+  for (dim = 0; dim < ndims; ++dim) {
+    astsub = ASD_SUBS(asd, dim);
+    subs[dim] = astsub;
+    if (A_TYPEG(astsub) != A_TRIPLE) {
+      if (A_SHAPEG(astsub))
+        return 0; /* vector subscript */
+      continue;
+    }
+    aststride = A_STRIDEG(astsub);
+    if (!aststride || A_ALIASG(aststride))
+      continue;
+    aststride = mk_binop(OP_EQ, mk_convert(aststride, astb.bnd.dtype),
+                         astb.bnd.one, DT_LOG);
+    test = test ? mk_binop(OP_LAND, test, aststride, DT_LOG) : aststride;
+    subs[dim] = mk_triple(A_LBDG(astsub), A_UPBDG(astsub), 0);
+  }
+  if (!test)
+    return 0;
+  if (!continuous_section(0, mk_subscr(A_LOPG(arr_ast), subs, ndims,
+                                       A_DTYPEG(arr_ast)), 0, 0))
+    return 0;
+  return test;
+} /* runtime_contiguity_test */
+
 /*  stride-1 memory rule:
  *   Leftmost dimension has no stride.
  */
@@ -1606,11 +1606,12 @@ _readln(int mx_len, LOGICAL len_err)
   char *p, *q;
 
   long_pragma_candidate = FALSE;
-  if ((c = getc(curr_fd)) == EOF) {
+  if ((c = FE_GETC(curr_fd)) == EOF) {
+    fclose(curr_fd);
     if (incl_level == 0) {
       gbl.eof_flag = TRUE;
+      cpp_release(); /* the stream may have been reading it */
     }
-    fclose(curr_fd);
     return NULL;
   }
   curr_line++;
@@ -1631,14 +1632,14 @@ _readln(int mx_len, LOGICAL len_err)
       }
       /* skip to the end-of-line */
       while (1) {
-        c = getc(curr_fd);
+        c = FE_GETC(curr_fd);
         if (c == '\n' || c == EOF)
           break;
       }
       break;
     }
     *++p = c;
-    c = getc(curr_fd);
+    c = FE_GETC(curr_fd);
     if (c == EOF) {
       /* this can't be the first character of the line; this case
        * is detected as end-of-file (see above).
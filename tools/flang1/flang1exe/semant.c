@@ -2347,7 +2347,7 @@ semant1(int rednum, SST *top)
     if (sem.pgphase != PHASE_INIT && !sem.interface) {
       if (IN_MODULE && !have_module_state()) {
         /* terminate -- ow, reset_module_state() will issue
-         * an ICE because modstate_file is NULL; could say
+         * an ICE because there is no module state; could say
          * something about CONTAINS, but we currently cannot
          * detect the missing CONTAINS of a module after the
          * first.
@@ -3611,7 +3611,7 @@ void rw_semant_state(RW_ROUTINE, RW_FILE)
   RW_SCALAR(stb.curr_scope);
   RW_SCALAR(sem.scope_level);
   if (!sem.scope_stack) {
-    fseek(fd, sizeof(SCOPESTACK) * (sem.scope_level + 1), 1);
+    RW_SKIP(SCOPESTACK, sem.scope_level + 1);
   } else {
     if (ISREAD()) {
       NEED(sem.scope_level + 1, sem.scope_stack, SCOPESTACK, sem.scope_size,
@@ -601,6 +601,11 @@ static void add_pragmasyms(int pragmatype, int pragmascope, ITEM *itemp, int);
 static void add_pragma(int pragmatype, int pragmascope, int pragmaarg);
 
 #define OPT_OMP_ATOMIC !XBIT(69,0x1000)
+#define OPT_OMP_TREE_REDUCTION XBIT(69,0x2000)
+
+/* set while end_reduction() emits the combine statements of a reduction
+ * that the back end turns into a __kmpc_reduce_nowait region */
+static LOGICAL in_tree_reduction = FALSE;
 
 static int kernel_argnum;
 
@@ -9113,7 +9118,7 @@ gen_reduction(REDUC *reducp, REDUC_SYM *reduc_symp, LOGICAL rmme,
       sem.mpaccatomic.mem_order = save_mem_order;
       add_stmt(mk_stmt(A_MP_ENDATOMIC, 0));
       goto end_reduction;
-    } else {
+    } else if (!in_tree_reduction) {
       add_stmt(mk_stmt(A_MP_ENDATOMIC, 0));
       noatomic = TRUE;
       ast_crit = emit_bcs_ecs(A_MP_CRITICAL);
@@ -9161,7 +9166,7 @@ gen_reduction(REDUC *reducp, REDUC_SYM *reduc_symp, LOGICAL rmme,
       sem.mpaccatomic.mem_order = save_mem_order;
       add_stmt(mk_stmt(A_MP_ENDATOMIC, 0));
       goto end_reduction;
-    } else {
+    } else if (!in_tree_reduction) {
       add_stmt(mk_stmt(A_MP_ENDATOMIC, 0));
       ast_crit = emit_bcs_ecs(A_MP_CRITICAL);
       noatomic = TRUE;
@@ -9185,6 +9190,185 @@ end_reduction:
   }
 }
 
+/*
+ * Return the MP_REDOP_ operator with which the back end combines the
+ * private copies of a tree reduction item, or MP_REDOP_NONE if the item
+ * has to be combined by the atomic/critical section code.  Only scalars
+ * and constant-size arrays of the integer, real, complex and logical
+ * types whose combine is an elementwise machine operation qualify.
+ */
+static int
+tree_reduction_op(REDUC *reducp, REDUC_SYM *reduc_symp)
+{
+  int sptr = reduc_symp->shared;
+  int dtype = DTYPEG(sptr);
+  char *nm;
+
+  if (POINTERG(sptr) || ALLOCATTRG(sptr) || ALLOCG(sptr))
+    return MP_REDOP_NONE;
+  if (DTY(dtype) == TY_ARRAY) {
+    if (ADD_DEFER(dtype) || ADD_ASSUMSHP(dtype) || ADD_ADJARR(dtype) ||
+        !ADD_NUMELM(dtype) || !A_ALIASG(ADD_NUMELM(dtype)))
+      return MP_REDOP_NONE;
+    dtype = DDTG(dtype);
+  }
+  switch (DTY(dtype)) {
+  case TY_BINT:
+  case TY_SINT:
+  case TY_INT:
+  case TY_INT8:
+  case TY_REAL:
+  case TY_DBLE:
+  case TY_CMPLX:
+  case TY_DCMPLX:
+  case TY_BLOG:
+  case TY_SLOG:
+  case TY_LOG:
+  case TY_LOG8:
+    break;
+  default:
+    return MP_REDOP_NONE;
+  }
+
+  switch (reducp->opr) {
+  case OP_ADD:
+  case OP_SUB:
+    if (DT_ISLOG(dtype))
+      return MP_REDOP_NONE;
+    return MP_REDOP_ADD;
+  case OP_MUL:
+    if (DT_ISLOG(dtype))
+      return MP_REDOP_NONE;
+    return MP_REDOP_MUL;
+  case OP_LOG:
+    if (!DT_ISLOG(dtype))
+      return MP_REDOP_NONE;
+    switch (reducp->intrin) {
+    case OP_LAND:
+      return MP_REDOP_IAND;
+    case OP_LOR:
+      return MP_REDOP_IOR;
+    case OP_LNEQV:
+      return MP_REDOP_IEOR;
+    default:
+      /* .eqv. depends on the representation of .true. */
+      return MP_REDOP_NONE;
+    }
+  case 0: /* intrinsic */
+    nm = SYMNAME(reducp->intrin);
+    if (DT_ISINT(dtype) || DT_ISREAL(dtype)) {
+      if (strcmp(nm, "max") == 0)
+        return MP_REDOP_MAX;
+      if (strcmp(nm, "min") == 0)
+        return MP_REDOP_MIN;
+    }
+    if (DT_ISINT(dtype)) {
+      if (strcmp(nm, "iand") == 0)
+        return MP_REDOP_IAND;
+      if (strcmp(nm, "ior") == 0)
+        return MP_REDOP_IOR;
+      if (strcmp(nm, "ieor") == 0)
+        return MP_REDOP_IEOR;
+    }
+    return MP_REDOP_NONE;
+  default:
+    return MP_REDOP_NONE;
+  }
+}
+
+/*
+ * Decide whether the reductions of construct doif are combined with the
+ * __kmpc_reduce_nowait protocol (-Mx,69,0x2000): the runtime combines the
+ * threads' private copies pairwise in a tree and only the thread(s) it
+ * selects update the shared variables.  All threads of the team must
+ * reach the combine, so only worksharing and parallel constructs on the
+ * host qualify, and every item of every clause must be eligible.
+ */
+static LOGICAL
+use_tree_reduction(REDUC *red, int doif)
+{
+  REDUC *reducp;
+  REDUC_SYM *reduc_symp;
+  LOGICAL any = FALSE;
+
+  if (!OPT_OMP_TREE_REDUCTION)
+    return FALSE;
+  switch (DI_ID(doif)) {
+  case DI_PAR:
+  case DI_PARDO:
+  case DI_PDO:
+  case DI_PARSECTS:
+  case DI_SECTS:
+  case DI_PARWORKS:
+    break;
+  default:
+    return FALSE;
+  }
+  if (DI_IN_NEST(doif, DI_TARGET) || DI_IN_NEST(doif, DI_TEAMS) ||
+      DI_IN_NEST(doif, DI_CRITICAL))
+    return FALSE;
+
+  for (reducp = red; reducp; reducp = reducp->next) {
+    for (reduc_symp = reducp->list; reduc_symp; reduc_symp = reduc_symp->next) {
+      if (reduc_symp->shared == 0)
+        continue;
+      if (tree_reduction_op(reducp, reduc_symp) == MP_REDOP_NONE)
+        return FALSE;
+      any = TRUE;
+    }
+  }
+  return any;
+}
+
+/*
+ * Generate:
+ *    mp_breduction
+ *    mp_reductionitem shared, private, MP_REDOP_xxx    (for each item)
+ *    critical
+ *    shared <-- shared <op> private                   (for each item)
+ *    endcritical
+ *    mp_ereduction
+ * The back end expands the critical section into the __kmpc_reduce_nowait
+ * and __kmpc_end_reduce_nowait calls, so the combines are plain updates.
+ */
+static void
+gen_tree_reduction(REDUC *red, LOGICAL in_parallel)
+{
+  REDUC *reducp;
+  REDUC_SYM *reduc_symp;
+  int ast, ast_crit, ast_endcrit;
+
+  (void)add_stmt(mk_stmt(A_MP_BREDUCTION, 0));
+  for (reducp = red; reducp; reducp = reducp->next) {
+    for (reduc_symp = reducp->list; reduc_symp; reduc_symp = reduc_symp->next) {
+      if (reduc_symp->shared == 0)
+        continue;
+      ast = mk_stmt(A_MP_REDUCTIONITEM, 0);
+      A_SHSYMP(ast, reduc_symp->shared);
+      A_PRVSYMP(ast, reduc_symp->Private);
+      A_REDOPRP(ast, tree_reduction_op(reducp, reduc_symp));
+      (void)add_stmt(ast);
+    }
+  }
+
+  ast_crit = emit_bcs_ecs(A_MP_CRITICAL);
+  A_ISOMPREDUCTIONP(ast_crit, 1);
+  in_tree_reduction = TRUE;
+  for (reducp = red; reducp; reducp = reducp->next) {
+    for (reduc_symp = reducp->list; reduc_symp; reduc_symp = reduc_symp->next) {
+      if (reduc_symp->shared == 0)
+        continue;
+      gen_reduction(reducp, reduc_symp, FALSE, in_parallel);
+    }
+  }
+  in_tree_reduction = FALSE;
+  ast_endcrit = emit_bcs_ecs(A_MP_ENDCRITICAL);
+  A_ISOMPREDUCTIONP(ast_endcrit, 1);
+  A_LOPP(ast_crit, ast_endcrit);
+  A_LOPP(ast_endcrit, ast_crit);
+  (void)add_stmt(mk_stmt(A_MP_EREDUCTION, 0));
+}
+
 static void
 end_reduction(REDUC *red, int doif)
 {
@@ -9215,6 +9399,15 @@ end_reduction(REDUC *red, int doif)
   sem.teams = 0;
   in_parallel = (save_par || save_target || save_teams);
 
+  if (use_tree_reduction(red, doif)) {
+    gen_tree_reduction(red, in_parallel);
+    sem.ignore_default_none = FALSE;
+    sem.parallel = save_par;
+    sem.target = save_target;
+    sem.teams = save_teams;
+    return;
+  }
+
   if (DI_ID(doif) == DI_SIMD) {
     for (reducp = red; reducp; reducp = reducp->next) {
       for (reduc_symp = reducp->list; reduc_symp;
@@ -11581,6 +11774,8 @@ LOGICAL use_opt_atomic(int d)
 static LOGICAL use_atomic_for_reduction(int d, REDUC *reducp,
     REDUC_SYM *red_sym) // AOCC
 {
+  if (in_tree_reduction)
+    return FALSE;
 #ifdef OMP_OFFLOAD_LLVM
   if(flg.omptarget && DI_IN_NEST(d, DI_TARGET) ) {
     // AOCC begin
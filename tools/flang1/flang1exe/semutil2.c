@@ -13458,7 +13458,73 @@ rw_host_state(int wherefrom, int (*p_rw)(), FILE *fd)
   }
 } /* rw_host_state */
 
-static FILE *state_file = NULL;
+/*
+ * The host and module states are restored at the start of every
+ * contained subprogram, in both parses, and rewritten whenever another
+ * subprogram's interface is imported.  They are kept in memory rather
+ * than in temporary files so that each save and restore is a copy; the
+ * buffer position behaves like the file position did.
+ */
+typedef struct {
+  char *base;
+  int size;  /* bytes allocated */
+  int avail; /* bytes written */
+  int pos;   /* current read/write position */
+} STATE_MEM;
+
+static STATE_MEM *rw_mem = NULL; /* buffer for rw_mem_read/rw_mem_write */
+
+/** \brief rw_routine to save state to the current memory buffer;
+    a NULL address skips over (and clears) the space.
+ */
+int
+rw_mem_write(void *p, size_t size, size_t n, FILE *fd)
+{
+  int len = size * n;
+  NEED(rw_mem->pos + len, rw_mem->base, char, rw_mem->size,
+       rw_mem->size + rw_mem->pos + len);
+  if (p)
+    memcpy(rw_mem->base + rw_mem->pos, p, len);
+  else
+    memset(rw_mem->base + rw_mem->pos, 0, len);
+  rw_mem->pos += len;
+  if (rw_mem->pos > rw_mem->avail)
+    rw_mem->avail = rw_mem->pos;
+  return n;
+} /* rw_mem_write */
+
+/** \brief rw_routine to restore state from the current memory buffer;
+    a NULL address skips over the space.
+ */
+int
+rw_mem_read(void *p, size_t size, size_t n, FILE *fd)
+{
+  int len = size * n;
+  if (rw_mem->pos + len > rw_mem->avail)
+    return 0;
+  if (p)
+    memcpy(p, rw_mem->base + rw_mem->pos, len);
+  rw_mem->pos += len;
+  return n;
+} /* rw_mem_read */
+
+static void
+rw_state_mem(STATE_MEM *mem, int wherefrom, int (*p_rw)())
+{
+  rw_mem = mem;
+  rw_host_state(wherefrom, p_rw, NULL);
+  rw_mem = NULL;
+} /* rw_state_mem */
+
+static void
+free_state_mem(STATE_MEM *mem)
+{
+  if (mem->base)
+    FREE(mem->base);
+  mem->size = mem->avail = mem->pos = 0;
+} /* free_state_mem */
+
+static STATE_MEM state_mem = {NULL, 0, 0, 0};
 static FILE *state_append_file = NULL;
 static int saved_symavl = 0;
 static int saved_astavl = 0;
@@ -13494,15 +13560,9 @@ void
 save_host_state(int wherefrom)
 {
   /* use quick binary read/write */
-  if (state_file) {
-    if (wherefrom & 0x21) {
-      /* seek to the beginning before writing first data */
-      fseek(state_file, 0L, 0);
-    }
-  } else {
-    state_file = tmpf("b");
-    if (state_file == NULL)
-      errfatal(5);
+  if (wherefrom & 0x21) {
+    /* seek to the beginning before writing first data */
+    state_mem.pos = 0;
   }
   if (wherefrom & 0x2) {
     /* clear the SECD field of ST_ARRDSC symbols */
@@ -13515,7 +13575,7 @@ save_host_state(int wherefrom)
       }
     }
   }
-  rw_host_state(wherefrom, (int (*)())fwrite, state_file);
+  rw_state_mem(&state_mem, wherefrom, (int (*)())rw_mem_write);
   saved_symavl = stb.stg_avail;
   saved_astavl = astb.stg_avail;
   saved_dtyavl = stb.dt.stg_avail;
@@ -13617,20 +13677,20 @@ fix_symtab()
 void
 restore_host_state(int whichpass)
 {
-  if (state_file == NULL)
+  if (state_mem.base == NULL)
     interr("no state file to restore", 0, 4);
 
   if (whichpass == 2) {
-    fseek(state_file, 0L, 0);
-    rw_host_state(0x13, (int (*)())fread, state_file);
+    state_mem.pos = 0;
+    rw_state_mem(&state_mem, 0x13, (int (*)())rw_mem_read);
     /*astb.firstuast = astb.stg_avail;*/
     /* ### don't reset firstusym for main program */
     stb.firstusym = stb.stg_avail;
     state_still_pass_one = 0;
     fix_symtab();
   } else if (whichpass == 4) { /* for ipa import */
-    fseek(state_file, 0L, 0);
-    rw_host_state(0x2, (int (*)())fread, state_file);
+    state_mem.pos = 0;
+    rw_state_mem(&state_mem, 0x2, (int (*)())rw_mem_read);
     /*astb.firstuast = astb.stg_avail;*/
     /* ### don't reset firstusym for main program */
     stb.firstusym = stb.stg_avail;
@@ -13708,8 +13768,8 @@ restore_host_state(int whichpass)
     sem.flabels = 0;
     saved_labels[saved_labels_avail] = ';';
 
-    fseek(state_file, 0L, 0);
-    rw_host_state(0x3, (int (*)())fread, state_file);
+    state_mem.pos = 0;
+    rw_state_mem(&state_mem, 0x3, (int (*)())rw_mem_read);
     /*astb.firstuast = astb.stg_avail;*/
 
     fseek(state_append_file, state_file_position, 0);
@@ -13816,7 +13876,7 @@ reset_internal_subprograms()
   state_append_file_full = FALSE;
 } /* reset_internal_subprograms */
 
-static FILE *modstate_file = NULL;
+static STATE_MEM modstate_mem = {NULL, 0, 0, 0};
 static FILE *modstate_append_file = NULL;
 static int modsaved_symavl, modsaved_astavl, modsaved_dtyavl;
 static int modstate_append_file_full = 0;
@@ -13833,20 +13893,14 @@ static LOGICAL modsave_ieee_features;
 void
 save_module_state1()
 {
-  if (modstate_file) {
-    fseek(modstate_file, 0L, 0);
-  } else {
-    modstate_file = tmpf("m");
-    if (modstate_file == NULL)
-      errfatal(5);
-  }
-  rw_host_state(0x1, (int (*)())fwrite, modstate_file);
+  modstate_mem.pos = 0;
+  rw_state_mem(&modstate_mem, 0x1, (int (*)())rw_mem_write);
 } /* save_module_state1 */
 
 void
 save_module_state2()
 {
-  rw_host_state(0x16, (int (*)())fwrite, modstate_file);
+  rw_state_mem(&modstate_mem, 0x16, (int (*)())rw_mem_write);
   modsaved_symavl = stb.stg_avail;
   modsaved_astavl = astb.stg_avail;
   modsaved_dtyavl = stb.dt.stg_avail;
@@ -13885,7 +13939,7 @@ restore_imported_modules_state()
  *   integer function f << now here, we add function 'f', hide variable 'f'
  * ...
  * the problem is that hiding variable 'f' happens too late, we've already
- * got all the information for 'f' in modstate_file; so we keep
+ * got all the information for 'f' in the saved module state; so we keep
  * track of this situation (semsym.c:replace_variable) and when it
  * arises, and we restore the module state, we re-hide 'f'.
  * We only need to keep track of a single variable at a time.
@@ -13905,11 +13959,11 @@ module_must_hide_this_symbol(int sptr)
 void
 restore_module_state()
 {
-  if (modstate_file == NULL)
+  if (modstate_mem.base == NULL)
     errfatal(5);
   /* First, read the binary-saved information */
-  fseek(modstate_file, 0L, 0);
-  rw_host_state(0x17, (int (*)())fread, modstate_file);
+  modstate_mem.pos = 0;
+  rw_state_mem(&modstate_mem, 0x17, (int (*)())rw_mem_read);
   /* for TPR 1654, if we need to set NEEDMOD for internal
    * subprograms, this is the place to set it
    * NEEDMODP( stb.curr_scope, 1 );
@@ -13936,8 +13990,8 @@ restore_module_state()
     modstate_append_file_full = 0;
     mod_clear_init = 0;
     /* Lastly, rewrite the module state file */
-    fseek(modstate_file, 0L, 0);
-    rw_host_state(0x17, (int (*)())fwrite, modstate_file);
+    modstate_mem.pos = 0;
+    rw_state_mem(&modstate_mem, 0x17, (int (*)())rw_mem_write);
     modsaved_symavl = stb.stg_avail;
     modsaved_astavl = astb.stg_avail;
     modsaved_dtyavl = stb.dt.stg_avail;
@@ -13951,11 +14005,11 @@ restore_module_state()
 void
 reset_module_state()
 {
-  if (modstate_file == NULL)
+  if (modstate_mem.base == NULL)
     interr("no module state file to restore", 0, 4);
   if (sem.which_pass == 1) {
-    fseek(modstate_file, 0L, 0);
-    rw_host_state(0x17, (int (*)())fread, modstate_file);
+    modstate_mem.pos = 0;
+    rw_state_mem(&modstate_mem, 0x17, (int (*)())rw_mem_read);
   } else {
     /* export the module-contained subprogram */
     if (!modstate_append_file) {
@@ -13974,7 +14028,7 @@ reset_module_state()
 int
 have_module_state()
 {
-  if (modstate_file == NULL)
+  if (modstate_mem.base == NULL)
     return 0;
   return 1;
 }
@@ -13984,9 +14038,8 @@ have_module_state()
 void
 sem_fini(void)
 {
-  if (state_file)
-    fclose(state_file);
-  state_file = NULL;
+  free_state_mem(&state_mem);
+  free_state_mem(&modstate_mem);
   if (state_append_file)
     fclose(state_append_file);
   state_append_file = NULL;
@@ -26,6 +26,20 @@
  */
 #define RW_SCALAR(b) RW_FD(&b, b, 1)
 
+/*
+ * to skip over an array in the state file:
+ *   RW_SKIP( datatype, number-elements )
+ * state kept in memory has no file (fd is NULL); its rw_routines treat
+ * a NULL address as a skip
+ */
+#define RW_SKIP(s, n)                          \
+  {                                            \
+    if (fd)                                    \
+      fseek(fd, sizeof(s) * (n), 1);           \
+    else                                       \
+      (void)(*p_rw)(NULL, sizeof(s), n, fd);   \
+  }
+
 /*
  * the rw_routine should be declared:
  *   void rw_routine( RW_ROUTINE, RW_FILE )
@@ -40,8 +54,12 @@
  * sometimes special action is taken on read or write.
  * use these macros to test whether this is a write (save) or read (restore)
  */
-#define ISREAD() (p_rw == (RW_ROUTINE_TYPE)fread)
-#define ISWRITE() (p_rw == (RW_ROUTINE_TYPE)fwrite)
+#define ISREAD() (p_rw == (RW_ROUTINE_TYPE)fread || p_rw == rw_mem_read)
+#define ISWRITE() (p_rw == (RW_ROUTINE_TYPE)fwrite || p_rw == rw_mem_write)
+
+/* rw_routines for state kept in memory rather than in a file */
+extern int rw_mem_read(void *, size_t, size_t, FILE *);  /* semutil2.c */
+extern int rw_mem_write(void *, size_t, size_t, FILE *); /* semutil2.c */
 
 extern void rw_dpmout_state(RW_ROUTINE, RW_FILE);
 extern void rw_semant_state(RW_ROUTINE, RW_FILE); /* semfin.c */
@@ -24,8 +24,13 @@
 #include "hpfutl.h"
 #include "rte.h"
 #include "semant.h"
+#include "ccffinfo.h"
 
 #define CONTIGUOUS_ARR(sptr) (ALLOCG(sptr) || CONTIGATTRG(sptr))
+
+/* Temps of at most this many bytes and constant shape are not allocated at
+ * -O2; see check_small_allocatable(). */
+#define SMALL_TEMP_BYTES 1024
 static int find_alloc_size(int ast, int foralllist, int *allocss,
                            int *allocdtype, int *allocdim);
 static int do_check_member_id(int astmem, int astid);
@@ -1685,15 +1690,24 @@ mk_shape_sptr(int shape, int *subscr, int elem_dty)
 /*
  * If this is a temporary allocatable array,
  * see if it is small enough that we should just leave it on the stack.
+ * -x 2 0x1000 does this for temps of up to 20 elements; at -O2, temps of
+ * intrinsic type up to SMALL_TEMP_BYTES are left on the stack as well,
+ * unless -x 47 0x800.
  */
 void
 check_small_allocatable(int sptr)
 {
-  int i, n, ex, small;
+  int i, n, ex;
   int eldt;
   ISZ_T size;
   ADSC *ad;
-  if (!XBIT(2, 0x1000))
+  LOGICAL bytes;
+
+  if (XBIT(2, 0x1000))
+    bytes = FALSE;
+  else if (flg.opt >= 2 && !XBIT(47, 0x800))
+    bytes = TRUE;
+  else
     return;
   eldt = DTY(DTYPEG(sptr) + 1);
   if (DTY(eldt) == TY_CHAR
@@ -1706,10 +1720,12 @@ check_small_allocatable(int sptr)
     if (!A_ALIASG(DTY(eldt + 1)))
       return;
   }
+  /* derived type temps may need their components initialized or freed */
+  if (bytes && (DTY(eldt) == TY_DERIVED || !ALLOCG(sptr)))
+    return;
   ad = AD_DPTR(DTYPEG(sptr));
   n = AD_NUMDIM(ad);
-  small = 1;
-  size = 1;
+  size = bytes ? size_of(eldt) : 1;
   for (i = 0; i < n; ++i) {
     ex = AD_EXTNTAST(ad, i);
     if (!A_ALIASG(ex)) {
@@ -1717,7 +1733,7 @@ check_small_allocatable(int sptr)
     }
     ex = A_ALIASG(ex);
     size *= ad_val_of(A_SPTRG(ex));
-    if (size > 20) {
+    if (size > (bytes ? SMALL_TEMP_BYTES : 20)) {
       return;
     }
   }
@@ -1727,6 +1743,9 @@ check_small_allocatable(int sptr)
     SCP(sptr, SCG(MIDNUMG(sptr)));
     MIDNUMP(sptr, 0);
   }
+  ccff_info(MSGOPT, "OPT052", 1, gbl.lineno,
+            "Array temp %var allocated on the stack", "var=%s",
+            SYMNAME(sptr), NULL);
 } /* check_small_allocatable */
 
 /* if non-constant DIM
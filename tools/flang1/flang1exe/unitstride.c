@@ -0,0 +1,465 @@
+/*
+ * Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See https://llvm.org/LICENSE.txt for license information.
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+/** \file
+    \brief Version loop nests on pointer arrays having unit stride.
+
+    An element reference to an F90 pointer array is addressed through its
+    section descriptor: the back end reloads the base pointer, the byte
+    length, the local base offset and the multiplier of every dimension at
+    each reference, and since the leftmost multiplier is unknown the loop
+    cannot be vectorized.  A DO loop nest that only contains assignments
+    and structured IFs is duplicated under a test that every pointer array
+    it references has a unit leftmost multiplier and a byte length equal to
+    its element size.  In the copy, each pointer array is replaced by an
+    adjustable Cray pointee (the 'view') whose hidden pointer, bounds,
+    remaining multipliers and zero-base offset are copied into scalar temps
+    ahead of the nest, and whose leftmost multiplier is the constant one:
+    <pre>
+      if (lmult(p$sd, 1) .eq. 1 .and. len(p$sd) .eq. size) then
+        p$p1 = p$p ; z_u_0 = lower(p$sd, 1) ; ...
+        <nest referencing p$u with unit stride>
+      else
+        <original nest>
+      endif
+    </pre>
+    The view is flagged PTRVIEW, which is not 'noconflict' and which the
+    back end links to its hidden pointer like a POINTER array, so its
+    references keep the may-alias treatment of the pointer references
+    they replace.
+ */
+
+#include "gbldefs.h"
+#include "global.h"
+#include "error.h"
+#include "symtab.h"
+#include "symutl.h"
+#include "dtypeutl.h"
+#include "ast.h"
+#include "optimize.h"
+#include "rte.h"
+#include "extern.h"
+#include "ccffinfo.h"
+
+/* largest nest, in statements, that is duplicated */
+#define VERSION_MAX_STMTS 64
+/* pointer arrays tracked per nest */
+#define MAX_PTRS 16
+
+static struct {
+  int sptr;
+  LOGICAL whole; /* referenced other than as an array element */
+  int view;      /* adjustable pointee with a unit leftmost multiplier */
+} ptrs[MAX_PTRS];
+static int nptrs;
+
+static int tmpcnt = 0;
+
+static LOGICAL
+is_candidate(int sptr)
+{
+  int dtype, sdsc;
+
+  if (STYPEG(sptr) != ST_ARRAY || !POINTERG(sptr))
+    return FALSE;
+  dtype = DTYPEG(sptr);
+  if (DTY(dtype) != TY_ARRAY)
+    return FALSE;
+  sdsc = SDSCG(sptr);
+  if (!sdsc || !MIDNUMG(sptr) || SDSCS1G(sdsc) || CONTIGATTRG(sptr))
+    return FALSE;
+  if (STYPEG(sdsc) == ST_MEMBER || STYPEG(MIDNUMG(sptr)) == ST_MEMBER)
+    return FALSE;
+  switch (DTYG(dtype)) {
+  case TY_CHAR:
+  case TY_NCHAR:
+  case TY_DERIVED:
+  case TY_STRUCT:
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static void
+add_ptr(int sptr, LOGICAL whole)
+{
+  int i;
+
+  for (i = 0; i < nptrs; ++i) {
+    if (ptrs[i].sptr == sptr) {
+      if (whole)
+        ptrs[i].whole = TRUE;
+      return;
+    }
+  }
+  if (nptrs >= MAX_PTRS)
+    return;
+  ptrs[nptrs].sptr = sptr;
+  ptrs[nptrs].whole = whole;
+  ++nptrs;
+}
+
+/*
+ * Check that expression 'ast' may be evaluated inside a versioned nest:
+ * no calls and nothing that can change a pointer association.  Record the
+ * candidate pointer arrays it references.
+ */
+static LOGICAL
+check_expr(int ast)
+{
+  int asd, argt, i, sptr;
+
+  if (ast == 0)
+    return TRUE;
+  switch (A_TYPEG(ast)) {
+  case A_CNST:
+  case A_CMPLXC:
+    return TRUE;
+  case A_ID:
+    sptr = A_SPTRG(ast);
+    if (is_candidate(sptr))
+      add_ptr(sptr, TRUE);
+    return TRUE;
+  case A_BINOP:
+    return check_expr(A_LOPG(ast)) && check_expr(A_ROPG(ast));
+  case A_UNOP:
+  case A_CONV:
+  case A_PAREN:
+    return check_expr(A_LOPG(ast));
+  case A_MEM:
+    return check_expr(A_PARENTG(ast));
+  case A_SUBSTR:
+    return check_expr(A_LOPG(ast)) && check_expr(A_LEFTG(ast)) &&
+           check_expr(A_RIGHTG(ast));
+  case A_SUBSCR:
+    asd = A_ASDG(ast);
+    for (i = 0; i < ASD_NDIM(asd); ++i) {
+      if (A_TYPEG(ASD_SUBS(asd, i)) == A_TRIPLE ||
+          !check_expr(ASD_SUBS(asd, i)))
+        return FALSE;
+    }
+    if (A_TYPEG(A_LOPG(ast)) == A_ID && A_SHAPEG(ast) == 0) {
+      sptr = A_SPTRG(A_LOPG(ast));
+      if (is_candidate(sptr))
+        add_ptr(sptr, FALSE);
+      return TRUE;
+    }
+    return check_expr(A_LOPG(ast));
+  case A_INTR:
+    if (A_SHAPEG(ast))
+      return FALSE;
+    argt = A_ARGSG(ast);
+    for (i = 0; i < A_ARGCNTG(ast); ++i) {
+      if (!check_expr(ARGT_ARG(argt, i)))
+        return FALSE;
+    }
+    return TRUE;
+  default:
+    return FALSE;
+  }
+}
+
+/* a store through 'dest' must not touch a pointer or a descriptor */
+static LOGICAL
+check_dest(int dest)
+{
+  int sptr;
+
+  if (A_SHAPEG(dest))
+    return FALSE;
+  sptr = sym_of_ast(dest);
+  if (DTYPEG(sptr) == DT_PTR || PTRVG(sptr) || DESCARRAYG(sptr) ||
+      STYPEG(sptr) == ST_DESCRIPTOR || STYPEG(sptr) == ST_ARRDSC)
+    return FALSE;
+  return check_expr(dest);
+}
+
+static LOGICAL
+check_stmt(int ast)
+{
+  switch (A_TYPEG(ast)) {
+  case A_ASN:
+    return check_dest(A_DESTG(ast)) && check_expr(A_SRCG(ast));
+  case A_IF:
+    return check_expr(A_IFEXPRG(ast)) && check_stmt(A_IFSTMTG(ast));
+  case A_IFTHEN:
+  case A_ELSEIF:
+    return check_expr(A_IFEXPRG(ast));
+  case A_ELSE:
+  case A_ENDIF:
+  case A_ENDDO:
+  case A_CONTINUE:
+    return TRUE;
+  case A_DO:
+    if (A_DOLABG(ast))
+      return FALSE;
+    return check_expr(A_DOVARG(ast)) && check_expr(A_M1G(ast)) &&
+           check_expr(A_M2G(ast)) && check_expr(A_M3G(ast)) &&
+           check_expr(A_M4G(ast));
+  default:
+    return FALSE;
+  }
+}
+
+/*
+ * Scan the DO nest starting at 'dostd'.  Return its ENDDO if every
+ * statement of the nest can be versioned, else 0.  The number of
+ * statements is returned in *pcount.
+ */
+static int
+scan_nest(int dostd, int *pcount)
+{
+  int std, depth, count;
+
+  depth = 0;
+  count = 0;
+  for (std = dostd; std; std = STD_NEXT(std)) {
+    int ast = STD_AST(std);
+    ++count;
+    if (STD_LABEL(std) || STD_ACCEL(std) || !check_stmt(ast))
+      return 0;
+    if (A_TYPEG(ast) == A_DO) {
+      ++depth;
+    } else if (A_TYPEG(ast) == A_ENDDO) {
+      if (--depth == 0) {
+        *pcount = count;
+        return std;
+      }
+    }
+  }
+  return 0;
+}
+
+static int
+mk_temp(int sc)
+{
+  int sptr;
+
+  sptr = getcctmp_sc('u', tmpcnt++, ST_VAR, astb.bnd.dtype, sc);
+  CCSYMP(sptr, 1);
+  return mk_id(sptr);
+}
+
+static int
+add_stmt_like(int ast, int like, int before)
+{
+  int std;
+
+  std = add_stmt_before(ast, before);
+  STD_LINENO(std) = STD_LINENO(like);
+  STD_PAR(std) = STD_PAR(like);
+  STD_TASK(std) = STD_TASK(like);
+  return std;
+}
+
+static void
+add_asn(int dest, int src, int dtype, int before)
+{
+  add_stmt_like(mk_assn_stmt(dest, src, dtype), before, before);
+}
+
+/*
+ * Return the test that pointer array 'ptrs[n]' has unit stride.  The
+ * element at p(i1,...,ir) is at p$p + (lbase - 1 + sum ik * lmult(k)) * len;
+ * len differs from the element size when p points to a component of a
+ * derived type array.
+ */
+static int
+mk_unit_test(int n)
+{
+  int sptr, sdsc, eldt, test, ast;
+
+  sptr = ptrs[n].sptr;
+  sdsc = SDSCG(sptr);
+  eldt = DTY(DTYPEG(sptr) + 1);
+  test = mk_binop(OP_EQ, get_local_multiplier(sdsc, 0), astb.bnd.one, DT_LOG);
+  ast = mk_binop(OP_EQ, get_byte_len(sdsc),
+                 mk_isz_cval(size_of(eldt), astb.bnd.dtype), DT_LOG);
+  return mk_binop(OP_LAND, test, ast, DT_LOG);
+}
+
+/*
+ * Create the view of pointer array 'ptrs[n]' and assign its hidden pointer
+ * and bounds temps before statement 'before'.  Under the unit stride test
+ * the view has multipliers 1, lmult(2), ..., lmult(r) and a zero-base
+ * offset of 1 - lbase.
+ */
+static void
+mk_view(int n, int before, int sc)
+{
+  int sptr, sdsc, rank, eldt, k, ptr, zbase, view;
+  int lw, up, ext, mult;
+  ADSC *ad;
+
+  sptr = ptrs[n].sptr;
+  sdsc = SDSCG(sptr);
+  rank = rank_of_sym(sptr);
+  eldt = DTY(DTYPEG(sptr) + 1);
+
+  ptr = sym_get_ptr(sptr);
+  SCP(ptr, sc);
+  add_asn(mk_id(ptr), mk_id(MIDNUMG(sptr)), DT_PTR, before);
+  zbase = mk_temp(sc);
+  add_asn(zbase,
+          mk_binop(OP_SUB, astb.bnd.one, get_xbase(sdsc), astb.bnd.dtype),
+          astb.bnd.dtype, before);
+
+  view = sym_get_array(SYMNAME(sptr), "u", eldt, rank);
+  SCP(view, SC_BASED);
+  ALLOCP(view, 0);
+  MIDNUMP(view, ptr);
+  ADJARRP(view, 1);
+  SEQP(view, 1);
+  PTRVIEWP(view, 1); /* may alias what the pointer may */
+  ad = AD_DPTR(DTYPEG(view));
+  AD_ADJARR(ad) = 1;
+  for (k = 0; k < rank; ++k) {
+    lw = mk_temp(sc);
+    add_asn(lw, get_global_lower(sdsc, k), astb.bnd.dtype, before);
+    ext = mk_temp(sc);
+    add_asn(ext, get_extent(sdsc, k), astb.bnd.dtype, before);
+    up = mk_temp(sc);
+    add_asn(up,
+            mk_binop(OP_ADD, lw,
+                     mk_binop(OP_SUB, ext, astb.bnd.one, astb.bnd.dtype),
+                     astb.bnd.dtype),
+            astb.bnd.dtype, before);
+    if (k == 0) {
+      mult = astb.bnd.one;
+    } else {
+      mult = mk_temp(sc);
+      add_asn(mult, get_local_multiplier(sdsc, k), astb.bnd.dtype, before);
+    }
+    AD_LWBD(ad, k) = AD_LWAST(ad, k) = lw;
+    AD_UPBD(ad, k) = AD_UPAST(ad, k) = up;
+    AD_EXTNTAST(ad, k) = ext;
+    AD_MLPYR(ad, k) = mult;
+  }
+  AD_ZBASE(ad) = zbase;
+  ptrs[n].view = view;
+}
+
+/* copy statement 'ast' through the replacements set up by the caller */
+static int
+copy_stmt(int ast)
+{
+  int newast;
+
+  if (A_TYPEG(ast) == A_IF) {
+    newast = mk_stmt(A_IF, 0);
+    A_IFEXPRP(newast, ast_rewrite(A_IFEXPRG(ast)));
+    A_IFSTMTP(newast, copy_stmt(A_IFSTMTG(ast)));
+    return newast;
+  }
+  newast = ast_rewrite(ast);
+  if (newast == ast) {
+    /* the copy must not inherit the visit list linkage */
+    newast = mk_duplicate_ast(ast);
+    A_VISITP(newast, 0);
+    A_REPLP(newast, 0);
+  }
+  return newast;
+}
+
+static void
+report(int lineno)
+{
+  char names[200];
+  int n, len;
+
+  names[0] = '\0';
+  len = 0;
+  for (n = 0; n < nptrs; ++n) {
+    const char *nm;
+    if (ptrs[n].whole)
+      continue;
+    nm = SYMNAME(ptrs[n].sptr);
+    if (len + strlen(nm) + 3 >= sizeof(names))
+      break;
+    if (len)
+      len += sprintf(names + len, ", ");
+    len += sprintf(names + len, "%s", nm);
+  }
+  ccff_info(MSGOPT, "OPT054", 1, lineno,
+            "Loop versioned for unit stride of pointer %arrays", "arrays=%s",
+            names, NULL);
+}
+
+/*
+ * Version the nest dostd..enddostd; return the ENDIF that now ends it.
+ */
+static int
+version_nest(int dostd, int enddostd)
+{
+  int n, sc, cond, std, ast, last;
+
+  sc = STD_PAR(dostd) || STD_TASK(dostd) ? SC_PRIVATE : SC_LOCAL;
+  cond = 0;
+  for (n = 0; n < nptrs; ++n) {
+    if (!ptrs[n].whole) {
+      ast = mk_unit_test(n);
+      cond = cond ? mk_binop(OP_LAND, cond, ast, DT_LOG) : ast;
+    }
+  }
+  ast = mk_stmt(A_IFTHEN, 0);
+  A_IFEXPRP(ast, cond);
+  add_stmt_like(ast, dostd, dostd);
+  for (n = 0; n < nptrs; ++n) {
+    if (!ptrs[n].whole)
+      mk_view(n, dostd, sc);
+  }
+
+  ast_visit(1, 1);
+  for (n = 0; n < nptrs; ++n) {
+    if (!ptrs[n].whole)
+      ast_replace(mk_id(ptrs[n].sptr), mk_id(ptrs[n].view));
+  }
+  for (std = dostd;; std = STD_NEXT(std)) {
+    add_stmt_like(copy_stmt(STD_AST(std)), std, dostd);
+    if (std == enddostd)
+      break;
+  }
+  ast_unvisit();
+
+  add_stmt_like(mk_stmt(A_ELSE, 0), dostd, dostd);
+  last = add_stmt_after(mk_stmt(A_ENDIF, 0), enddostd);
+  STD_LINENO(last) = STD_LINENO(enddostd);
+  STD_PAR(last) = STD_PAR(enddostd);
+  STD_TASK(last) = STD_TASK(enddostd);
+  report(STD_LINENO(dostd));
+  return last;
+}
+
+/** \brief Version DO loop nests on the pointer arrays they reference
+    having unit stride.
+ */
+void
+unit_stride_versioning(void)
+{
+  int std;
+
+  if (XBIT(70, 0x2))
+    return; /* keep subscript checks on the user's arrays */
+  for (std = STD_NEXT(0); std; std = STD_NEXT(std)) {
+    int enddostd, count, n;
+    LOGICAL any;
+
+    if (A_TYPEG(STD_AST(std)) != A_DO)
+      continue;
+    nptrs = 0;
+    enddostd = scan_nest(std, &count);
+    if (!enddostd || count > VERSION_MAX_STMTS)
+      continue; /* try the inner loops */
+    any = FALSE;
+    for (n = 0; n < nptrs; ++n) {
+      if (!ptrs[n].whole)
+        any = TRUE;
+    }
+    if (any)
+      std = version_nest(std, enddostd);
+  }
+}
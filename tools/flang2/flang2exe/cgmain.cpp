@@ -404,6 +404,9 @@ static LL_Type *make_function_type_from_args(LL_Type *return_type,
 static bool match_prototypes(LL_Type *ty1, LL_Type *ty2);
 static MATCH_Kind match_types(LL_Type *, LL_Type *);
 static int decimal_value_from_oct(int, int, int);
+#if defined(TARGET_LLVM_X8664)
+static void llvm_compiler_used_add(const char *);
+#endif
 static char *vect_llvm_intrinsic_name(int);
 static const char *vect_power_intrinsic_name(int);
 static void build_unused_global_define_from_params(void);
@@ -2749,6 +2752,72 @@ maybe_fixup_x86_abi_return(LL_Type *sig)
 }
 #endif
 
+#if defined(TARGET_LLVM_X8664)
+/* libpgmath functions whose vector entries LLVM's PGMATH library tables do
+ * not list; calls to them name their vector variants explicitly.
+ */
+static const char *const pgmath_vector_fns[] = {
+    "erf",       "erfc",      "erfc_scaled", "gamma",     "log_gamma",
+    "bessel_j0", "bessel_j1", "bessel_y0",   "bessel_y1", NULL};
+
+/**
+ * \brief Write the vector-function-abi-variant attribute for a call
+ * \param fname  name of the callee
+ *
+ * \p fname is a scalar libpgmath entry such as \c __fd_erf_1.  Name each
+ * vector entry (\c __fd_erf_2, \c __fd_erf_4, ...) that fits the target's
+ * vector registers, declare it, and keep the declaration alive in
+ * \c @llvm.compiler.used until the loop vectorizer has run.
+ */
+static void
+write_vector_variants(const char *fname)
+{
+  const char *const *fn;
+  const char *root;
+  char vname[48], buf[200];
+  size_t len;
+  int elsz, n, maxbits;
+  const char *elty;
+
+  if (strncmp(fname, "__", 2) != 0 || !strchr("frp", fname[2]) ||
+      !strchr("sd", fname[3]) || fname[4] != '_')
+    return;
+  root = fname + 5;
+  len = strlen(root);
+  if (len < 3 || strcmp(root + len - 2, "_1") != 0)
+    return;
+  for (fn = pgmath_vector_fns; *fn; ++fn) {
+    if (strlen(*fn) == len - 2 && strncmp(*fn, root, len - 2) == 0)
+      break;
+  }
+  if (!*fn)
+    return;
+
+  elsz = fname[3] == 'd' ? 64 : 32;
+  elty = fname[3] == 'd' ? "double" : "float";
+  maxbits = GENERATE_AVX3 ? 512 : GENERATE_AVX ? 256 : 128;
+  print_token(" \"vector-function-abi-variant\"=\"");
+  for (n = 128 / elsz; n * elsz <= maxbits; n *= 2) {
+    LL_FnProto *proto;
+
+    sprintf(vname, "%.5s%s_%d", fname, *fn, n);
+    sprintf(buf, "%s_ZGV_LLVM_N%dv_%s(%s)", n == 128 / elsz ? "" : ",", n,
+            fname, vname);
+    print_token(buf);
+    proto = ll_proto_add(vname, NULL);
+    if (proto->intrinsic_decl_str)
+      continue;
+    sprintf(buf, "declare <%d x %s> @%s(<%d x %s>) nounwind readnone", n, elty,
+            vname, n, elty);
+    ll_proto_set_intrinsic(vname, buf);
+    sprintf(buf, "i8* bitcast (<%d x %s> (<%d x %s>)* @%s to i8*)", n, elty, n,
+            elty, vname);
+    llvm_compiler_used_add(buf);
+  }
+  print_token("\"");
+}
+#endif
+
 /**
  * \brief write \c I_CALL instruction
  * \param curr_instr  pointer to current instruction instance
@@ -2870,6 +2939,10 @@ write_I_CALL(INSTR_LIST *curr_instr, bool emit_func_signature_for_call)
     write_operands(call_op->next, 0);
     /* if no arguments, write out the parens */
     print_token(")");
+#if defined(TARGET_LLVM_X8664)
+  if (call_op->ot_type == OT_VAR && sptr > NOSYM && STYPEG(sptr) == ST_PROC)
+    write_vector_variants(SYMNAME(sptr));
+#endif
   if (callRequiresTrunc) {
     print_dbg_line(curr_instr->dbg_line_op);
     print_token("\n\t");
@@ -14803,6 +14876,14 @@ cg_llvm_end(void)
     ll_write_metadata(gbl.ompaccfile, gpu_llvm_module);
   }
 #endif
+  if (DBGBIT(12, 0x80000)) {
+    FILE *dfil = gbl.dbgfil ? gbl.dbgfil : stderr;
+    ll_dump_unique_stats(dfil, cpu_llvm_module);
+#ifdef OMP_OFFLOAD_LLVM
+    if (flg.omptarget)
+      ll_dump_unique_stats(dfil, gpu_llvm_module);
+#endif
+  }
 }
 
 /**
@@ -15000,6 +15081,7 @@ typedef struct init_list_t {
 
 static init_list_t llvm_ctor_list;
 static init_list_t llvm_dtor_list;
+static init_list_t llvm_compiler_used_list;
 
 static void
 llvm_add_to_init_list(const char *name, int priority, init_list_t *list)
@@ -15092,11 +15174,46 @@ llvm_write_ctor_dtor_list(init_list_t *list, const char *global_name)
   print_nl();
 }
 
+#if defined(TARGET_LLVM_X8664)
+/**
+   \brief Add a constant (an \c i8* value) to \c @llvm.compiler.used
+ */
+static void
+llvm_compiler_used_add(const char *value)
+{
+  llvm_add_to_init_list(value, LLVM_DEFAULT_PRIORITY,
+                        &llvm_compiler_used_list);
+}
+#endif
+
+static void
+llvm_write_compiler_used(void)
+{
+  struct init_node *node;
+  char int_str_buffer[20];
+
+  if (llvm_compiler_used_list.size == 0)
+    return;
+
+  print_token("@llvm.compiler.used = appending global [");
+  sprintf(int_str_buffer, "%d", llvm_compiler_used_list.size);
+  print_token(int_str_buffer);
+  print_token(" x i8*] [");
+  for (node = llvm_compiler_used_list.head; node != NULL; node = node->next) {
+    print_token(node->name);
+    if (node->next != NULL)
+      print_token(", ");
+  }
+  print_token("], section \"llvm.metadata\"");
+  print_nl();
+}
+
 void
 llvm_write_ctors()
 {
   llvm_write_ctor_dtor_list(&llvm_ctor_list, "llvm.global_ctors");
   llvm_write_ctor_dtor_list(&llvm_dtor_list, "llvm.global_dtors");
+  llvm_write_compiler_used();
 }
 
 void
@@ -73,6 +73,17 @@ void
 ds_init(void)
 {
   int i;
+
+  /* Release the previous function's areas before allocating new ones;
+   * otherwise each function leaves its ili, ilt, bih and nme tables behind
+   * and the heap grows with the number of functions in the file.
+   */
+  exp_cleanup();
+  ili_cleanup();
+  ilt_cleanup();
+  bih_cleanup();
+  nme_end();
+
   ili_init();
   ilt_init();
   bih_init();
@@ -77,7 +77,9 @@ static int addMpUnp(void);
 static int addMpUnv(void);
 static int addMpBcsNest(void);
 static int addMpEcsNest(void);
+static int addMpEndReduceNowait(void);
 static int allocThreadprivate(SPTR sym, int *tmpthr);
+static void exp_host_reduction(void);
 
 #define mk_prototype mk_prototype_llvm
 
@@ -108,6 +110,7 @@ static int taskdup;
 static int taskIfv;        /* value of if clause for BTASK & TASKREG */
 static SPTR taskFlags;     ///< value of final clause for BTASK & TASKREG
 static SPTR taskFnsptr;    ///< store task func sptr
+
 static SPTR taskAllocSptr; ///< store the return value from kmpc_alloc
 static int maxOutlinedCnt; /* maximum parCnt for a function */
 static int sumOutlinedCnt; /* sum of parCnts of functions already
@@ -198,6 +201,25 @@ typedef struct sptrListT {
   int cplus_assign_rou;
 } sptrListT;
 
+/* Host tree reduction (-Mx,69,0x2000) state: the items collected between
+ * MP_BREDUCTION and MP_EREDUCTION, the critical section nesting level that
+ * __kmpc_reduce_nowait replaces, and the label that threads with nothing to
+ * combine branch to.
+ */
+typedef struct {
+  SPTR sptr; /* private copy */
+  int redop; /* MP_REDOP */
+} HOSTRED_ITEM;
+
+static struct {
+  HOSTRED_ITEM *base;
+  int size;
+  int cnt;
+  bool begun;
+  int crit;
+  SPTR skip;
+} hostred;
+
 /* called once per function */
 void
 exp_smp_init(void)
@@ -215,6 +237,11 @@ exp_smp_init(void)
   mppgcnt = 0;
   taskCnt = 0;
   taskLoopCnt = 0;
+  hostred.size = 8;
+  NEW(hostred.base, HOSTRED_ITEM, hostred.size);
+  hostred.cnt = 0;
+  hostred.begun = false;
+  hostred.crit = 0;
 }
 
 void
@@ -222,6 +249,7 @@ exp_smp_fini(void)
 {
   sumOutlinedCnt = +maxOutlinedCnt;
   FREE(mppgbih);
+  FREE(hostred.base);
 }
 
 static SPTR
@@ -1518,7 +1546,10 @@ exp_smp(ILM_OP opc, ILM *ilmp, int curilm)
     if (flg.amdgcn_target && gbl.ompaccel_intarget) {
     } else 
 #endif
-    {
+    if (hostred.begun && hostred.cnt && !hostred.crit) {
+      hostred.crit = critCnt;
+      exp_host_reduction();
+    } else {
     // AOCC End
       ili = addMpBcsNest();
       iltb.callfg = 1;
@@ -1541,7 +1572,15 @@ exp_smp(ILM_OP opc, ILM *ilmp, int curilm)
     if (flg.amdgcn_target && gbl.ompaccel_intarget) {
     } else 
 #endif
-    {
+    if (hostred.crit && critCnt == hostred.crit - 1) {
+      ili = addMpEndReduceNowait();
+      iltb.callfg = 1;
+      chk_block(ili);
+      wr_block();
+      cr_block();
+      exp_label(hostred.skip);
+      hostred.crit = 0;
+    } else {
       ili = addMpEcsNest();
       iltb.callfg = 1;
       chk_block(ili);
@@ -2997,14 +3036,38 @@ exp_smp(ILM_OP opc, ILM *ilmp, int curilm)
   case IM_ETASKFIRSTPRIV:
     break;
 #endif
+  case IM_MP_REDUCTIONITEM:
+#ifdef OMP_OFFLOAD_LLVM
+    if (flg.omptarget && gbl.ompaccel_intarget) {
+      exp_ompaccel_reductionitem(ilmp, curilm);
+      break;
+    }
+#endif
+    if (ll_ilm_is_rewriting() || !hostred.begun)
+      break;
+    NEED(hostred.cnt + 1, hostred.base, HOSTRED_ITEM, hostred.size,
+         hostred.size + 8);
+    hostred.base[hostred.cnt].sptr = ILM_SymOPND(ilmp, 2);
+    hostred.base[hostred.cnt].redop = ILM_OPND(ilmp, 3);
+    hostred.cnt++;
+    break;
+  case IM_MP_BREDUCTION:
+    if (ll_ilm_is_rewriting() || !XBIT(69, 0x2000))
+      break;
 #ifdef OMP_OFFLOAD_LLVM
-    case IM_MP_REDUCTIONITEM:
-      if (flg.omptarget && gbl.ompaccel_intarget)
-        exp_ompaccel_reductionitem(ilmp, curilm);
+    if (flg.omptarget && gbl.ompaccel_intarget)
       break;
-    case IM_MP_BREDUCTION:
-    case IM_MP_EREDUCTION:
+#endif
+    hostred.begun = true;
+    hostred.cnt = 0;
+    break;
+  case IM_MP_EREDUCTION:
+    if (ll_ilm_is_rewriting())
       break;
+    hostred.begun = false;
+    hostred.cnt = 0;
+    break;
+#ifdef OMP_OFFLOAD_LLVM
     case IM_MP_TARGETLOOPTRIPCOUNT:
       if(flg.omptarget)
         exp_ompaccel_looptripcount(ilmp, curilm);
@@ -3122,6 +3185,132 @@ ncpus_temp(SC_KIND sc)
   return sym;
 }
 
+/* int _mp_reduce_nowait(int nitems, size_t size, void *data) wraps
+ * __kmpc_reduce_nowait with the runtime's lock and _mp_reduce_kmpc.
+ */
+static int
+addMpReduceNowait(int nitems, int size, int data_ili)
+{
+  int argili, ili;
+
+  mk_prototype("_mp_reduce_nowait", NULL, DT_INT, 3, DT_INT, DT_INT8, DT_CPTR);
+  argili = jsrAddArg(0, IL_ARGAR, data_ili);
+  argili = jsrAddArg(argili, IL_ARGKR, ad_kconi(size));
+  argili = jsrAddArg(argili, IL_ARGIR, ad_icon(nitems));
+  ili = makeCall("_mp_reduce_nowait", IL_QJSR, argili);
+  return genretvalue(ili, IL_DFRIR);
+}
+
+static int
+addMpEndReduceNowait(void)
+{
+  mk_prototype("_mp_end_reduce_nowait", NULL, DT_NONE, 0);
+  return makeCall("_mp_end_reduce_nowait", IL_JSR, 0);
+}
+
+static MP_REDTY
+hostRedType(DTYPE dtype)
+{
+  switch (DTY(dtype)) {
+  case TY_BINT:
+  case TY_BLOG:
+    return MP_REDTY_I1;
+  case TY_SINT:
+  case TY_SLOG:
+    return MP_REDTY_I2;
+  case TY_INT:
+  case TY_LOG:
+    return MP_REDTY_I4;
+  case TY_INT8:
+  case TY_LOG8:
+    return MP_REDTY_I8;
+  case TY_REAL:
+    return MP_REDTY_R4;
+  case TY_DBLE:
+    return MP_REDTY_R8;
+  case TY_CMPLX:
+    return MP_REDTY_C8;
+  case TY_DCMPLX:
+    return MP_REDTY_C16;
+  default:
+    break;
+  }
+  interr("hostRedType: unexpected reduction type", dtype, ERR_Severe);
+  return MP_REDTY_NONE;
+}
+
+/* Replace the critical section guarding a host reduction with a call to
+ * __kmpc_reduce_nowait.  Each thread describes its private copies in an
+ * int64 array laid out as in mp.h (MP_RED_HDR, MP_RED_ITEM); the runtime
+ * combines these pairwise through _mp_reduce_kmpc, up a tree when it
+ * chooses to, and returns 1 to the thread(s) that must then fold the result
+ * into the shared variables.  Everybody else branches to hostred.skip, which
+ * is placed after the matching IM_ECS.
+ */
+static void
+exp_host_reduction(void)
+{
+  int i, k, ili, nme, basenme, n_elts;
+  SPTR array;
+  DTYPE dtype;
+  static int id;
+
+  n_elts = MP_RED_HDR + MP_RED_ITEM * hostred.cnt;
+  array = getnewccsym('r', ++id, ST_ARRAY);
+  {
+    ADSC *adsc;
+    INT con[2] = {0, n_elts};
+
+    dtype = get_array_dtype(1, DT_INT8);
+    adsc = AD_DPTR(dtype);
+    AD_LWBD(adsc, 0) = stb.i1;
+    AD_UPBD(adsc, 0) = getcon(con, DT_INT);
+    AD_NUMELM(adsc) = AD_UPBD(adsc, 0);
+  }
+  DTYPEP(array, dtype);
+  SCP(array, SC_AUTO);
+
+  basenme = addnme(NT_VAR, array, 0, 0);
+  nme = add_arrnme(NT_ARR, array, basenme, 0, ad_icon(0), false);
+  ili = ad4ili(IL_STKR, ad_kconi(hostred.cnt), ad_acon(array, 0), nme, MSZ_I8);
+  chk_block(ili);
+
+  for (k = 0, i = MP_RED_HDR; k < hostred.cnt; ++k, i += MP_RED_ITEM) {
+    SPTR sptr = hostred.base[k].sptr;
+    DTYPE dt = DTYPEG(sptr);
+    DTYPE eldt = DDTG(dt);
+    int code = hostred.base[k].redop | (hostRedType(eldt) << 8);
+    ISZ_T count = size_of(dt) / size_of(eldt);
+    int addr;
+
+    nme = add_arrnme(NT_ARR, array, basenme, 0, ad_icon(i), false);
+    ili = ad4ili(IL_STKR, ad_kconi(code), ad_acon(array, i * 8), nme, MSZ_I8);
+    chk_block(ili);
+
+    nme = add_arrnme(NT_ARR, array, basenme, 0, ad_icon(i + 1), false);
+    ili =
+        ad4ili(IL_STKR, ad_kconi(count), ad_acon(array, (i + 1) * 8), nme, MSZ_I8);
+    chk_block(ili);
+
+    if (SCG(sptr) == SC_BASED && MIDNUMG(sptr)) {
+      SPTR ptr = MIDNUMG(sptr);
+      addr = ad2ili(IL_LDA, mk_address(ptr), addnme(NT_VAR, ptr, 0, 0));
+    } else {
+      addr = mk_address(sptr);
+    }
+    nme = add_arrnme(NT_ARR, array, basenme, 0, ad_icon(i + 2), false);
+    ili = ad3ili(IL_STA, addr, ad_acon(array, (i + 2) * 8), nme);
+    chk_block(ili);
+  }
+
+  ili = addMpReduceNowait(hostred.cnt, n_elts * 8, ad_acon(array, 0));
+  hostred.skip = getlab();
+  ili = ad4ili(IL_ICJMP, ili, ad_icon(1), CC_NE, hostred.skip);
+  RFCNTI(hostred.skip);
+  iltb.callfg = 1;
+  chk_block(ili);
+}
+
 static int
 addMpBcsNest(void)
 {
@@ -7042,6 +7042,99 @@ addarth(ILI *ilip)
     return ad1altili(opc, op1, ilix);
 #endif
     /* AOCC end */
+
+  case IL_FERF:
+    root = MTH_I_ERF;
+    mth_fn = MTH_erf;
+    goto do_sp_special;
+  case IL_FERFC:
+    root = MTH_I_ERFC;
+    mth_fn = MTH_erfc;
+    goto do_sp_special;
+  case IL_FERFC_SCALED:
+    root = MTH_I_ERFC_SCALED;
+    mth_fn = MTH_erfc_scaled;
+    goto do_sp_special;
+  case IL_FGAMMA:
+    root = MTH_I_GAMMA;
+    mth_fn = MTH_gamma;
+    goto do_sp_special;
+  case IL_FLOG_GAMMA:
+    root = MTH_I_LOG_GAMMA;
+    mth_fn = MTH_log_gamma;
+    goto do_sp_special;
+  case IL_FBESSEL_J0:
+    root = MTH_I_BESSEL_J0;
+    mth_fn = MTH_bessel_j0;
+    goto do_sp_special;
+  case IL_FBESSEL_J1:
+    root = MTH_I_BESSEL_J1;
+    mth_fn = MTH_bessel_j1;
+    goto do_sp_special;
+  case IL_FBESSEL_Y0:
+    root = MTH_I_BESSEL_Y0;
+    mth_fn = MTH_bessel_y0;
+    goto do_sp_special;
+  case IL_FBESSEL_Y1:
+    root = MTH_I_BESSEL_Y1;
+    mth_fn = MTH_bessel_y1;
+    goto do_sp_special;
+  do_sp_special:
+    /* The libpgmath names are what the vector variants are keyed on. */
+    if (XBIT_NEW_MATH_NAMES) {
+      fname = make_math(mth_fn, &funcsptr, 1, false, DT_FLOAT, 1, DT_FLOAT);
+      ilix = ad_func(IL_spfunc, IL_QJSR, fname, 1, op1);
+    } else {
+      (void)mk_prototype(root, "f pure", DT_FLOAT, 1, DT_FLOAT);
+      ilix = ad_func(IL_DFRSP, IL_QJSR, root, 1, op1);
+    }
+    return ad1altili(opc, op1, ilix);
+
+  case IL_DERF:
+    root = MTH_I_DERF;
+    mth_fn = MTH_erf;
+    goto do_dp_special;
+  case IL_DERFC:
+    root = MTH_I_DERFC;
+    mth_fn = MTH_erfc;
+    goto do_dp_special;
+  case IL_DERFC_SCALED:
+    root = MTH_I_DERFC_SCALED;
+    mth_fn = MTH_erfc_scaled;
+    goto do_dp_special;
+  case IL_DGAMMA:
+    root = MTH_I_DGAMMA;
+    mth_fn = MTH_gamma;
+    goto do_dp_special;
+  case IL_DLOG_GAMMA:
+    root = MTH_I_DLOG_GAMMA;
+    mth_fn = MTH_log_gamma;
+    goto do_dp_special;
+  case IL_DBESSEL_J0:
+    root = MTH_I_DBESSEL_J0;
+    mth_fn = MTH_bessel_j0;
+    goto do_dp_special;
+  case IL_DBESSEL_J1:
+    root = MTH_I_DBESSEL_J1;
+    mth_fn = MTH_bessel_j1;
+    goto do_dp_special;
+  case IL_DBESSEL_Y0:
+    root = MTH_I_DBESSEL_Y0;
+    mth_fn = MTH_bessel_y0;
+    goto do_dp_special;
+  case IL_DBESSEL_Y1:
+    root = MTH_I_DBESSEL_Y1;
+    mth_fn = MTH_bessel_y1;
+    goto do_dp_special;
+  do_dp_special:
+    if (XBIT_NEW_MATH_NAMES) {
+      fname = make_math(mth_fn, &funcsptr, 1, false, DT_DBLE, 1, DT_DBLE);
+      ilix = ad_func(IL_dpfunc, IL_QJSR, fname, 1, op1);
+    } else {
+      (void)mk_prototype(root, "f pure", DT_DBLE, 1, DT_DBLE);
+      ilix = ad_func(IL_DFRDP, IL_QJSR, root, 1, op1);
+    }
+    return ad1altili(opc, op1, ilix);
     
   case IL_DTAN:
  #ifdef OMP_OFFLOAD_LLVM
@@ -10910,6 +11003,26 @@ mark_ili(int val)
     }
 }
 
+/** \brief Count the ili reachable from the ILT of the current function.
+ *
+ * Uses the garbage collector's marking, so everything it would keep is
+ * counted as live.
+ */
+int
+count_live_ili(void)
+{
+  int ii, live;
+
+  mark_ili(GARB_VISITED);
+  live = 0;
+  for (ii = 1; ii < ilib.stg_avail; ii++) {
+    if (ILI_VISIT(ii))
+      ++live;
+    ILI_VISIT(ii) = 0;
+  }
+  return live;
+}
+
 /** \brief Search the ili subtree located by ilix for functions.  */
 bool
 func_in(int ilix)
@@ -15990,7 +16103,9 @@ make_math_name(MTH_FN fn, int vectlen, bool mask, DTYPE res_dt)
                            "div",  "exp",   "log",   "log10", "pow",    "powi",
                            "powk", "powi1", "powk1", "sin",   "sincos", "sinh",
                            "sqrt", "tan",   "tanh",  "mod", "floor", "ceil",
-                           "aint", "cotan"};
+                           "aint", "cotan", "erf", "erfc", "erfc_scaled",
+                           "gamma", "log_gamma", "bessel_j0", "bessel_j1",
+                           "bessel_y0", "bessel_y1"};
   char *fstr;
   char ftype = 'f';
   if (flg.ieee)
@@ -560,6 +560,11 @@ void choose_multiplier_64(int N, DBLUINT64 dd, int prec);
  */
 void choose_multiplier(int N, unsigned dd, int prec);
 
+/**
+   \brief Count the ili reachable from the ILT of the current function
+ */
+int count_live_ili(void);
+
 /**
    \brief ...
  */
@@ -1840,9 +1840,11 @@ rdgilms(int mode)
     nw = nilms - BOS_SIZE;
     /* read in the remaining part of the ILM block  */
     /* make sure we have enough for this ILM block and the
-     * BOS of the next ILM block */
+     * BOS of the next ILM block; grow geometrically, a large subprogram
+     * has tens of thousands of blocks */
     NEED(gilmb.ilmavl + nilms + 2 * BOS_SIZE + GILMSAVE, gilmb.ilm_base, ILM_T,
-         gilmb.ilm_size, gilmb.ilm_size + nilms + 1000);
+         gilmb.ilm_size,
+         gilmb.ilm_size + (gilmb.ilm_size >> 1) + nilms + 1000);
 
     if (gilmb_mode == 1) {
       i = fread((void *)(gilmb.ilm_base + gilmb.ilmavl + BOS_SIZE),
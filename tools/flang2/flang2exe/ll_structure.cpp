@@ -314,6 +314,7 @@ mdnode_hash(hash_key_t key)
   unsigned i;
   hash_accu_t hacc = HASH_ACCU_INIT;
 
+  HASH_ACCU_ADD(hacc, t->mdclass);
   HASH_ACCU_ADD(hacc, t->num_elems);
   for (i = 0; i < t->num_elems; i++) {
     HASH_ACCU_ADD(hacc, LL_MDREF_kind(t->elem[i]));
@@ -331,7 +332,7 @@ mdnode_equal(hash_key_t key_a, hash_key_t key_b)
   const LL_MDNode *b = (const LL_MDNode *)key_b;
   unsigned i;
 
-  if (a->num_elems != b->num_elems)
+  if (a->mdclass != b->mdclass || a->num_elems != b->num_elems)
     return false;
 
   for (i = 0; i < a->num_elems; i++)
@@ -488,6 +489,32 @@ compute_datalayout(LLVMModuleRef module)
   module->datalayout_string = triple->datalayout;
 }
 
+static void
+dump_unique_line(FILE *out, const char *what, unsigned lookups, unsigned hits,
+                 unsigned entries)
+{
+  fprintf(out, "  %-10s %10u lookups %10u hits (%5.1f%%) %10u entries\n", what,
+          lookups, hits, lookups ? 100.0 * hits / lookups : 0.0, entries);
+}
+
+void
+ll_dump_unique_stats(FILE *out, LLVMModuleRef module)
+{
+  const LL_UniqueStats *st = &module->unique_stats;
+
+  fprintf(out, "Uniquing statistics for module %s:\n", module->module_name);
+  dump_unique_line(out, "types", st->types_lookups, st->types_hits,
+                   hashset_size(module->anon_types));
+  dump_unique_line(out, "constants", st->constants_lookups,
+                   st->constants_hits, module->constants_count);
+  dump_unique_line(out, "mdstrings", st->mdstrings_lookups,
+                   st->mdstrings_hits, module->mdstrings_count);
+  dump_unique_line(out, "mdnodes", st->mdnodes_lookups, st->mdnodes_hits,
+                   module->mdnodes_count);
+  fprintf(out, "  %-10s %10u distinct or flexible\n", "",
+          st->mdnodes_distinct);
+}
+
 void
 ll_destroy_module(LLVMModuleRef module)
 {
@@ -1035,8 +1062,11 @@ unique_type(LLVMModuleRef module, const struct LL_Type_ *type)
   hash_key_t existing = hashset_lookup(module->anon_types, type);
   struct LL_Type_ *copy;
 
-  if (existing)
+  module->unique_stats.types_lookups++;
+  if (existing) {
+    module->unique_stats.types_hits++;
     return (struct LL_Type_ *)existing;
+  }
 
   /* No such type exists. Save a copy. */
   copy = (struct LL_Type_ *)ll_manage_malloc(module, sizeof(struct LL_Type_));
@@ -1629,8 +1659,11 @@ intern_constant(LLVMModuleRef module, LL_Type *type, const char *data)
   temp.type_struct = type;
 
   /* Was this constant seen before? */
-  if (hashmap_lookup(module->constants_map, &temp, &oldval))
+  module->unique_stats.constants_lookups++;
+  if (hashmap_lookup(module->constants_map, &temp, &oldval)) {
+    module->unique_stats.constants_hits++;
     return HKEY2INT(oldval);
+  }
 
   /* First time we see this constant. */
   newval = ll_create_value_from_type(module, type, data);
@@ -1958,7 +1991,9 @@ ll_get_md_rawstring(LLVMModuleRef module, const void *rawstr, size_t length)
   *p++ = 0;
 
   /* Is this a known string? */
+  module->unique_stats.mdstrings_lookups++;
   if (hashmap_lookup(module->mdstrings_map, str, &oldval)) {
+    module->unique_stats.mdstrings_hits++;
     mdref = LL_MDREF_ctor(mdref, HKEY2INT(oldval));
     free(str);
     return mdref;
@@ -2136,8 +2171,10 @@ ll_get_md_node(LLVMModuleRef module, enum LL_MDClass mdclass,
   hash_data_t oldval;
   unsigned mdnum;
 
+  module->unique_stats.mdnodes_lookups++;
   if (hashmap_lookup(module->mdnodes_map, node, &oldval)) {
     /* This is a duplicate, free the one we just allocated. */
+    module->unique_stats.mdnodes_hits++;
     free(node);
     mdnum = HKEY2INT(oldval);
   } else {
@@ -2189,6 +2226,7 @@ ll_create_distinct_md_node(LLVMModuleRef module, enum LL_MDClass mdclass,
 {
   LL_MDNode *node = alloc_mdnode(module, mdclass, elems, nelems, true);
   LL_MDRef md = LL_MDREF_INITIALIZER(MDRef_Node, insert_mdnode(module, node));
+  module->unique_stats.mdnodes_distinct++;
   return md;
 }
 
@@ -2200,6 +2238,7 @@ ll_create_flexible_md_node(LLVMModuleRef module)
 {
   LL_MDNode *node = alloc_flexible_mdnode(module, NULL, 0);
   LL_MDRef md = LL_MDREF_INITIALIZER(MDRef_Node, insert_mdnode(module, node));
+  module->unique_stats.mdnodes_distinct++;
   return md;
 }
 
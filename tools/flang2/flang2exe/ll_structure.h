@@ -926,6 +926,24 @@ typedef struct LL_DebugInfo LL_DebugInfo;
 
 struct LL_ABI_Info_;
 
+/**
+   \brief Hash-consing counters for the uniqued tables of a module
+
+   Each table counts the structural lookups made and how many of them found an
+   existing entry instead of creating a new one.
+ */
+typedef struct LL_UniqueStats {
+  unsigned types_lookups;
+  unsigned types_hits;
+  unsigned constants_lookups;
+  unsigned constants_hits;
+  unsigned mdstrings_lookups;
+  unsigned mdstrings_hits;
+  unsigned mdnodes_lookups;
+  unsigned mdnodes_hits;
+  unsigned mdnodes_distinct; /**< distinct and flexible nodes */
+} LL_UniqueStats;
+
 /**
    \brief LLVM Module proxy
  */
@@ -995,6 +1013,7 @@ typedef struct LL_Module {
   hashmap_t common_debug_map; /**< "scope_name/common_name" -> LL_MDRef */
   hashmap_t modvar_debug_map; /**< "mod_name/var_name" -> LL_MDRef */
 
+  LL_UniqueStats unique_stats;
 } LL_Module;
 
 /**
@@ -1441,6 +1460,12 @@ void ll_destroy_mem(struct LL_ManagedMallocs_ *current);
  */
 void ll_destroy_module(LLVMModuleRef module);
 
+/**
+   \brief Write the type, constant and metadata deduplication statistics of
+   \p module to \p out
+ */
+void ll_dump_unique_stats(FILE *out, LLVMModuleRef module);
+
 /**
    \brief ...
  */
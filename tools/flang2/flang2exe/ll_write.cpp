@@ -36,6 +36,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#if defined(__GLIBC__)
+#include <stdio_ext.h>
+#endif
 
 #ifdef TARGET_LLVM_ARM64
 #include "cgllvm.h"
@@ -58,6 +61,45 @@ static int debug_calls = 0;
 static int text_calls = 0;
 static const char *ll_get_atomic_memorder(LL_Instruction *inst);
 
+/* Private stdio buffers for the host and device IR streams. */
+static char ll_output_buffers[2][LL_OUTPUT_BUFSIZE];
+static FILE *ll_buffered_files[2];
+
+void
+ll_set_output_buffering(FILE *out)
+{
+  int i;
+
+  /* The standard streams may already have been written to. */
+  if (out == NULL || out == stdout || out == stderr)
+    return;
+  for (i = 0; i < 2; ++i) {
+    if (ll_buffered_files[i] == out)
+      return;
+    if (ll_buffered_files[i] == NULL)
+      break;
+  }
+  if (i == 2)
+    return;
+  if (setvbuf(out, ll_output_buffers[i], _IOFBF, LL_OUTPUT_BUFSIZE) != 0)
+    return;
+  ll_buffered_files[i] = out;
+#if defined(__GLIBC__)
+  __fsetlocking(out, FSETLOCKING_BYCALLER);
+#endif
+}
+
+void
+ll_release_output_buffering(FILE *out)
+{
+  int i;
+
+  for (i = 0; i < 2; ++i) {
+    if (ll_buffered_files[i] == out)
+      ll_buffered_files[i] = NULL;
+  }
+}
+
 static const char *
 ll_get_linkage_string(enum LL_LinkageType linkage)
 {
@@ -673,17 +715,19 @@ ll_write_instruction(FILE *out, LL_Instruction *inst, LL_Module *module, int no_
     break;
   }
   if (!LL_MDREF_IS_NULL(inst->dbg_line_op)) {
-    fprintf(out, ", !dbg !%u", LL_MDREF_value(inst->dbg_line_op));
+    ll_write_str(out, ", !dbg !");
+    ll_write_unsigned(out, LL_MDREF_value(inst->dbg_line_op));
   }
 #if DEBUG
   if (inst->comment)
     fprintf(out, " ; %s", inst->comment);
 #endif
 
-  fputc('\n', out);
-  if (print_branch_target)
-    fprintf(out, "%s:\n", inst->operands[2]->data);
-  fflush(out);
+  ll_write_char(out, '\n');
+  if (print_branch_target) {
+    ll_write_str(out, inst->operands[2]->data);
+    ll_write_str(out, ":\n");
+  }
 }
 
 /**
@@ -701,7 +745,8 @@ ll_write_object_dbg_references(FILE *out, LL_Module *m, LL_ObjToDbgList *ods)
     return;
   for (llObjtodbgFirst(ods, &i); !llObjtodbgAtEnd(&i); llObjtodbgNext(&i)) {
     LL_MDRef mdnode = llObjtodbgGet(&i);
-    fprintf(out, ", !dbg !%u", LL_MDREF_value(mdnode));
+    ll_write_str(out, ", !dbg !");
+    ll_write_unsigned(out, LL_MDREF_value(mdnode));
   }
   llObjtodbgFree(ods);
 }
@@ -734,8 +779,10 @@ ll_write_basicblock(FILE *out, LL_Function *function, LL_BasicBlock *block,
 {
   LL_Instruction *inst = block->first;
 
-  if (block->name)
-    fprintf(out, "%s:\n", block->name);
+  if (block->name) {
+    ll_write_str(out, block->name);
+    ll_write_str(out, ":\n");
+  }
 
   if (block == function->first) {
     // AOCC Begin
@@ -1614,36 +1661,44 @@ write_mdref(FILE *out, LL_Module *module, LL_MDRef rmdref,
 
   switch (LL_MDREF_kind(mdref)) {
   case MDRef_Node:
-    if (LL_MDREF_value(mdref))
-      fprintf(out, "%s!%u", tag, LL_MDREF_value(mdref));
-    else
-      fprintf(out, "null");
+    if (LL_MDREF_value(mdref)) {
+      ll_write_str(out, tag);
+      ll_write_char(out, '!');
+      ll_write_unsigned(out, LL_MDREF_value(mdref));
+    } else {
+      ll_write_str(out, "null");
+    }
     break;
 
   case MDRef_String:
     assert(LL_MDREF_value(mdref) < module->mdstrings_count, "Bad string MDRef",
            LL_MDREF_value(mdref), ERR_Fatal);
-    fprintf(out, "%s%s", tag, module->mdstrings[LL_MDREF_value(mdref)]);
+    ll_write_str(out, tag);
+    ll_write_str(out, module->mdstrings[LL_MDREF_value(mdref)]);
     break;
 
   case MDRef_Constant:
     assert(LL_MDREF_value(mdref) < module->constants_count,
            "Bad constant MDRef", LL_MDREF_value(mdref), ERR_Fatal);
-    fprintf(out, "%s %s",
-            module->constants[LL_MDREF_value(mdref)]->type_struct->str,
-            module->constants[LL_MDREF_value(mdref)]->data);
+    ll_write_str(out,
+                 module->constants[LL_MDREF_value(mdref)]->type_struct->str);
+    ll_write_char(out, ' ');
+    ll_write_str(out, module->constants[LL_MDREF_value(mdref)]->data);
     break;
 
   case MDRef_SmallInt1:
-    fprintf(out, "i1 %u", LL_MDREF_value(mdref));
+    ll_write_str(out, "i1 ");
+    ll_write_unsigned(out, LL_MDREF_value(mdref));
     break;
 
   case MDRef_SmallInt32:
-    fprintf(out, "i32 %u", LL_MDREF_value(mdref));
+    ll_write_str(out, "i32 ");
+    ll_write_unsigned(out, LL_MDREF_value(mdref));
     break;
 
   case MDRef_SmallInt64:
-    fprintf(out, "i64 %u", LL_MDREF_value(mdref));
+    ll_write_str(out, "i64 ");
+    ll_write_unsigned(out, LL_MDREF_value(mdref));
     break;
 
   default:
@@ -1715,7 +1770,10 @@ write_mdfield(FILE *out, LL_Module *module, int needs_comma, LL_MDRef mdref,
     if (value) {
       assert(tmpl->type == NodeField || tmpl->type == SignedOrMDField,
              "metadata elem should not be a mdnode", tmpl->type, ERR_Fatal);
-      fprintf(out, "%s%s: !%u", prefix, tmpl->name, value);
+      ll_write_str(out, prefix);
+      ll_write_str(out, tmpl->name);
+      ll_write_str(out, ": !");
+      ll_write_unsigned(out, value);
     } else if (mandatory) {
       fprintf(out, "%s%s: null", prefix, tmpl->name);
     } else {
@@ -1731,7 +1789,10 @@ write_mdfield(FILE *out, LL_Module *module, int needs_comma, LL_MDRef mdref,
     if (!mandatory && strcmp(module->mdstrings[value], "!\"\"") == 0)
       return false;
     /* The mdstrings[] entry is formatted as !"...". String the leading !. */
-    fprintf(out, "%s%s: %s", prefix, tmpl->name, module->mdstrings[value] + 1);
+    ll_write_str(out, prefix);
+    ll_write_str(out, tmpl->name);
+    ll_write_str(out, ": ");
+    ll_write_str(out, module->mdstrings[value] + 1);
     break;
 
   case MDRef_Constant:
@@ -1798,7 +1859,10 @@ write_mdfield(FILE *out, LL_Module *module, int needs_comma, LL_MDRef mdref,
     case UnsignedField:
     case SignedField:
     case SignedOrMDField:
-      fprintf(out, "%s%s: %u", prefix, tmpl->name, value);
+      ll_write_str(out, prefix);
+      ll_write_str(out, tmpl->name);
+      ll_write_str(out, ": ");
+      ll_write_unsigned(out, value);
       break;
 
     case BoolField:
@@ -1857,20 +1921,20 @@ write_mdnode_plain(FILE *out, LL_Module *module, const LL_MDNode *node,
   unsigned i;
 
   if (!omit_metadata_type)
-    fprintf(out, "metadata ");
+    ll_write_str(out, "metadata ");
 
   if (ll_feature_use_distinct_metadata(&module->ir) && node->is_distinct)
-    fprintf(out, "distinct ");
+    ll_write_str(out, "distinct ");
 
-  fprintf(out, "!{ ");
+  ll_write_str(out, "!{ ");
   for (i = 0; i < node->num_elems; i++) {
     LL_MDRef mdref = LL_MDREF_INITIALIZER(0, 0);
     mdref = node->elem[i];
     if (i > 0)
-      fprintf(out, ", ");
+      ll_write_str(out, ", ");
     write_mdref(out, module, mdref, omit_metadata_type);
   }
-  fprintf(out, " }\n");
+  ll_write_str(out, " }\n");
 }
 
 /*
@@ -1888,16 +1952,18 @@ write_mdnode_spec(FILE *out, LL_Module *module, const LL_MDNode *node,
   int needs_comma = false;
 
   if (ll_feature_use_distinct_metadata(&module->ir) && node->is_distinct)
-    fprintf(out, "distinct ");
+    ll_write_str(out, "distinct ");
 
   assert(node->num_elems <= num_fields, "metadata node has too many fields.",
          node->num_elems, ERR_Fatal);
 
-  fprintf(out, "!%s(", tmpl->name);
+  ll_write_char(out, '!');
+  ll_write_str(out, tmpl->name);
+  ll_write_char(out, '(');
   for (i = 0; i < node->num_elems; i++)
     if (write_mdfield(out, module, needs_comma, node->elem[i], &tmpl[i + 1]))
       needs_comma = true;
-  fprintf(out, ")\n");
+  ll_write_str(out, ")\n");
 }
 
 /**
@@ -1995,7 +2061,9 @@ static MDDispatch mdDispTable[LL_MDClass_MAX] = {
 INLINE static void
 emitRegularPrefix(FILE *out, unsigned mdi)
 {
-  fprintf(out, "!%u = ", mdi);
+  ll_write_char(out, '!');
+  ll_write_unsigned(out, mdi);
+  ll_write_str(out, " = ");
 }
 
 /** Simple helper function */
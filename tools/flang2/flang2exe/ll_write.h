@@ -11,6 +11,90 @@
 #include <stdio.h>
 #include "ll_structure.h"
 
+/*
+ * The IR writers emit text through many small stdio calls.  Streams that
+ * receive LLVM IR are given a large private buffer and, where the C library
+ * supports it, have their internal locking disabled (flang2 is single
+ * threaded), so the primitives below reduce to plain memory appends and the
+ * buffer is flushed to the file in large write() calls.
+ */
+#define LL_OUTPUT_BUFSIZE (1 << 20)
+
+#if defined(__GLIBC__)
+#define LL_FPUTS(s, f) fputs_unlocked(s, f)
+#define LL_FPUTC(c, f) fputc_unlocked(c, f)
+#define LL_FWRITE(p, n, f) fwrite_unlocked(p, 1, n, f)
+#else
+#define LL_FPUTS(s, f) fputs(s, f)
+#define LL_FPUTC(c, f) fputc(c, f)
+#define LL_FWRITE(p, n, f) fwrite(p, 1, n, f)
+#endif
+
+/**
+   \brief Write the string \p s to \p out without any formatting
+ */
+inline void
+ll_write_str(FILE *out, const char *s)
+{
+  LL_FPUTS(s, out);
+}
+
+/**
+   \brief Write the single character \p c to \p out
+ */
+inline void
+ll_write_char(FILE *out, int c)
+{
+  LL_FPUTC(c, out);
+}
+
+/**
+   \brief Write \p val in decimal without going through printf
+ */
+inline void
+ll_write_unsigned(FILE *out, unsigned long long val)
+{
+  char buf[24];
+  char *p = buf + sizeof(buf);
+
+  do {
+    *--p = '0' + (char)(val % 10);
+    val /= 10;
+  } while (val);
+  LL_FWRITE(p, (size_t)(buf + sizeof(buf) - p), out);
+}
+
+/**
+   \brief Write the signed value \p val in decimal
+ */
+inline void
+ll_write_signed(FILE *out, long long val)
+{
+  if (val < 0) {
+    LL_FPUTC('-', out);
+    ll_write_unsigned(out, 0ULL - (unsigned long long)val);
+  } else {
+    ll_write_unsigned(out, (unsigned long long)val);
+  }
+}
+
+/**
+   \brief Set up \p out to receive LLVM IR
+
+   Attaches a private buffer of \c LL_OUTPUT_BUFSIZE bytes and turns off
+   stdio locking for the stream.  Must be called before anything is written
+   to \p out.  At most two streams (host and offload device) are supported.
+ */
+void ll_set_output_buffering(FILE *out);
+
+/**
+   \brief Give back the buffer attached to \p out by ll_set_output_buffering
+
+   Must be called before \p out is closed, so that the buffer can be
+   reused by a later stream.
+ */
+void ll_release_output_buffering(FILE *out);
+
 /**
    \brief ...
  */
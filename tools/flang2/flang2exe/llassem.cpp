@@ -270,7 +270,9 @@ is_BIGOBJ()
 static int
 name_to_hash(const char *ag_name, int len)
 {
-  int hashval = ag_name[len - 1] | (ag_name[0] << 16) | (ag_name[1] << 8);
+  int hashval;
+
+  HASH_ID(hashval, ag_name, len);
   return hashval % AG_HASHSZ;
 }
 
@@ -5698,8 +5700,8 @@ llvm_funcptr_store(SPTR sptr, char *ag_name)
 
   sprintf(sptrnm, "%s_%d", get_llvm_name(sptr), sptr);
   hashval = name_to_hash(sptrnm, strlen(sptrnm));
-  fptr_local.hashtb[hashval] = gblsym;
   FPTR_HASHLK(gblsym) = fptr_local.hashtb[hashval];
+  fptr_local.hashtb[hashval] = gblsym;
   FPTR_SYMLK(gblsym) = ptr_local;
   nmptr = add_ag_fptr_name(sptrnm); /* fnptr_local key */
   FPTR_NMPTR(gblsym) = nmptr;
@@ -76,7 +76,7 @@ ISZ_T put_skip(ISZ_T old, ISZ_T New);
 
 /* structures and routines to process assembler globals for the entire file */
 
-#define AG_HASHSZ 19
+#define AG_HASHSZ 8191
 #define AG_SIZE(s) agb.s_base[s].size
 #define AG_ALIGN(s) agb.s_base[s].align
 #define AG_DSIZE(s) agb.s_base[s].dsize
@@ -18,28 +18,118 @@
 #include "ili.h"
 #include <stdlib.h>
 
-static INSTR_LIST **matrix_dg;
 static INSTR_LIST *last_instr;
 static int irank;
 static int size_dg;
 static int srank_dg;
 
+/*
+ * The dependence graph of the block being scheduled, in sparse form.  The
+ * instruction instr_dg[i], i = rank - srank_dg, has the successors
+ * succ_dg[first_dg[i]] .. succ_dg[first_dg[i + 1] - 1] (indices, in rank
+ * order) and npred_dg[i] predecessors that are not scheduled yet.
+ *
+ * All the edges into an instruction are found together, in rank order of
+ * the instruction, so while the graph is built only their predecessors
+ * are appended to edge_src; finish_sched_graph() then sorts them by
+ * predecessor.  An edge costs 8 bytes; a block whose graph would need more
+ * than MAX_SCHED_EDGES edges is left as it is.
+ */
+#define MAX_SCHED_EDGES (1 << 25)
+
+static int nedges_dg;
+static int max_edges_dg;
+static bool overflow_dg;
+static int *edge_src;
+static INSTR_LIST **instr_dg;
+static int *first_dg;
+static int *npred_dg;
+static int *mark_dg;       /* successor index of the last edge from i */
+static int *succ_dg;
+static INSTR_LIST **memops_dg; /* loads and stores built so far */
+static int nmemops_dg;
+static INSTR_LIST **sched_first; /* stack of [first, last] ranges of */
+static INSTR_LIST **sched_last;  /* instructions still to be expanded */
+
+static void
+free_sched_graph(void)
+{
+  free(edge_src);
+  free(instr_dg);
+  free(first_dg);
+  free(npred_dg);
+  free(mark_dg);
+  free(succ_dg);
+  free(memops_dg);
+  free(sched_first);
+  free(sched_last);
+  edge_src = NULL;
+  instr_dg = NULL;
+  first_dg = NULL;
+  npred_dg = NULL;
+  mark_dg = NULL;
+  succ_dg = NULL;
+  memops_dg = NULL;
+  sched_first = NULL;
+  sched_last = NULL;
+  max_edges_dg = 0;
+}
+
 static bool
 init_sched_graph(int size, int srank)
 {
+  int i;
+
   size_dg = size;
   srank_dg = srank;
-  matrix_dg = (INSTR_LIST**)realloc(matrix_dg, size * size *
-                                    sizeof(INSTR_LIST));
-  if (matrix_dg)
-    memset(matrix_dg, 0, size * size * sizeof(INSTR_LIST));
-  return (matrix_dg != NULL);
+  nedges_dg = 0;
+  nmemops_dg = 0;
+  overflow_dg = false;
+  /* index size is the block's terminator, which has no edges */
+  instr_dg =
+      (INSTR_LIST **)realloc(instr_dg, (size + 1) * sizeof(INSTR_LIST *));
+  first_dg = (int *)realloc(first_dg, (size + 2) * sizeof(int));
+  npred_dg = (int *)realloc(npred_dg, (size + 1) * sizeof(int));
+  mark_dg = (int *)realloc(mark_dg, (size + 1) * sizeof(int));
+  memops_dg = (INSTR_LIST **)realloc(memops_dg, size * sizeof(INSTR_LIST *));
+  sched_first =
+      (INSTR_LIST **)realloc(sched_first, (size + 1) * sizeof(INSTR_LIST *));
+  sched_last =
+      (INSTR_LIST **)realloc(sched_last, (size + 1) * sizeof(INSTR_LIST *));
+  if (!instr_dg || !first_dg || !npred_dg || !mark_dg || !memops_dg ||
+      !sched_first || !sched_last) {
+    free_sched_graph();
+    return false;
+  }
+  for (i = 0; i <= size; i++) {
+    npred_dg[i] = 0;
+    mark_dg[i] = -1;
+  }
+  return true;
+}
+
+static bool
+grow_edges(void)
+{
+  int n;
+  int *src;
+
+  if (max_edges_dg >= MAX_SCHED_EDGES)
+    return false;
+  n = max_edges_dg ? max_edges_dg * 2 : 1024;
+  if (n > MAX_SCHED_EDGES)
+    n = MAX_SCHED_EDGES;
+  src = (int *)realloc(edge_src, n * sizeof(int));
+  if (!src)
+    return false;
+  edge_src = src;
+  max_edges_dg = n;
+  return true;
 }
 
 static void
 add_successor(INSTR_LIST *instr, INSTR_LIST *succ)
 {
-  int mat_idx;
   int i, j;
 
   /* avoid creating circular dependency */
@@ -49,7 +139,44 @@ add_successor(INSTR_LIST *instr, INSTR_LIST *succ)
     return;
   i = instr->rank - srank_dg;
   j = succ->rank - srank_dg;
-  matrix_dg[size_dg * i + j] = succ;
+  if (mark_dg[i] == j || overflow_dg)
+    return;
+  if (nedges_dg == max_edges_dg && !grow_edges()) {
+    overflow_dg = true;
+    return;
+  }
+  mark_dg[i] = j;
+  edge_src[nedges_dg++] = i;
+  npred_dg[j]++;
+}
+
+/**
+   \brief Sort the edges collected by add_successor() by predecessor into
+   first_dg/succ_dg, keeping the successors of each in rank order.
+ */
+static bool
+finish_sched_graph(void)
+{
+  int i, j, e;
+
+  succ_dg = (int *)realloc(succ_dg, (nedges_dg ? nedges_dg : 1) * sizeof(int));
+  if (!succ_dg)
+    return false;
+  for (i = 0; i <= size_dg + 1; i++)
+    first_dg[i] = 0;
+  for (e = 0; e < nedges_dg; e++)
+    first_dg[edge_src[e] + 1]++;
+  for (i = 0; i <= size_dg; i++) {
+    first_dg[i + 1] += first_dg[i];
+    mark_dg[i] = first_dg[i];
+  }
+  /* the npred_dg[j] edges into j follow those into j - 1 */
+  e = 0;
+  for (j = 0; j <= size_dg; j++) {
+    for (i = 0; i < npred_dg[j]; i++, e++)
+      succ_dg[mark_dg[edge_src[e]]++] = j;
+  }
+  return true;
 }
 
 static bool
@@ -102,8 +229,7 @@ build_idep_graph(INSTR_LIST *iroot, INSTR_LIST *cur_instr)
 {
   INSTR_LIST *instr;
   int usecount = 0;
-  int instcount;
-  int ilix, c;
+  int ilix, c, m;
   bool first_load, has_pred;
   OPERAND *operand;
 
@@ -114,12 +240,11 @@ build_idep_graph(INSTR_LIST *iroot, INSTR_LIST *cur_instr)
   case I_LOAD:
     assert(cur_instr->tmps, "build_dep_graph():missing tmps for load instr ", 0,
            ERR_Fatal);
-    instr = cur_instr->prev;
     ilix = cur_instr->ilix;
     first_load = true;
-    instcount = 0;
-    while (instr && instr != iroot) {
-      instcount++;
+    /* the loads and stores of the block before cur_instr, latest first */
+    for (m = nmemops_dg - 1; m >= 0; m--) {
+      instr = memops_dg[m];
       switch (instr->i_name) {
       default:
         break;
@@ -139,14 +264,14 @@ build_idep_graph(INSTR_LIST *iroot, INSTR_LIST *cur_instr)
         }
         break;
       }
-      instr = instr->prev;
     }
+    memops_dg[nmemops_dg++] = cur_instr;
     break;
   case I_STORE:
-    instr = cur_instr->prev;
     ilix = cur_instr->ilix;
     first_load = true;
-    while (instr && instr != iroot) {
+    for (m = nmemops_dg - 1; m >= 0; m--) {
+      instr = memops_dg[m];
       switch (instr->i_name) {
       default:
         break;
@@ -181,8 +306,8 @@ build_idep_graph(INSTR_LIST *iroot, INSTR_LIST *cur_instr)
         }
         break;
       }
-      instr = instr->prev;
     }
+    memops_dg[nmemops_dg++] = cur_instr;
     break;
   }
   operand = cur_instr->operands;
@@ -260,10 +385,13 @@ build_block_idep_graph(INSTR_LIST *istart, bool *success)
         *success = init_sched_graph(inst_count, istart->rank);
         if (*success) {
           instr->flags |= ROOTDG;
-          while (bbinstr && (bbinstr != instr->next)) {
+          instr_dg[0] = istart;
+          while (bbinstr && (bbinstr != instr->next) && !overflow_dg) {
+            instr_dg[bbinstr->rank - srank_dg] = bbinstr;
             build_idep_graph(istart, bbinstr);
             bbinstr = bbinstr->next;
           }
+          *success = !overflow_dg && finish_sched_graph();
         }
       }
       return instr;
@@ -279,99 +407,88 @@ build_block_idep_graph(INSTR_LIST *istart, bool *success)
   return instr;
 }
 
-void
-sched_block_breadth_first(INSTR_LIST *istart, int level)
+/**
+   \brief Order in which sched_succs() takes the successors of an
+   instruction: GEP/LOAD/BITCAST first, stores last.
+ */
+static int
+sched_pass(INSTR_LIST *instr)
 {
-  int i, j, k, l;
-  INSTR_LIST *succ, *ssucc, *pred, *entry;
+  switch (instr->i_name) {
+  case I_GEP:
+  case I_BITCAST:
+  case I_LOAD:
+    return 0;
+  case I_STORE:
+    return 2;
+  default:
+    return 1;
+  }
+}
 
-  i = istart->rank - srank_dg;
+/**
+   \brief Remove the edges from instr and append the successors that have
+   no other predecessor left; return the first one appended, or NULL.
+ */
+static INSTR_LIST *
+sched_succs(INSTR_LIST *instr)
+{
+  int i, e, pass;
+  INSTR_LIST *succ, *entry;
 
   entry = last_instr;
-  /* Schedule GEP/LOAD/BITCAST first */
-  for (j = 0; j < size_dg; j++) {
-    succ = matrix_dg[i * size_dg + j];
-    if (succ) {
-      switch (succ->i_name) {
-      default:
-        break;
-      case I_GEP:
-      case I_BITCAST:
-      case I_LOAD:
-        matrix_dg[i * size_dg + j] = NULL;
-        pred = NULL;
-        for (k = 0; k < size_dg; k++) {
-          pred = matrix_dg[k * size_dg + j];
-          if (pred)
-            break;
-        }
-        if (pred == NULL) {
-          last_instr->next = succ;
-          succ->prev = last_instr;
-          last_instr = succ;
-          last_instr->next = NULL;
-        }
-        break;
+  i = instr->rank - srank_dg;
+  for (pass = 0; pass < 3; pass++) {
+    for (e = first_dg[i]; e < first_dg[i + 1]; e++) {
+      succ = instr_dg[succ_dg[e]];
+      if (sched_pass(succ) != pass)
+        continue;
+      if (--npred_dg[succ_dg[e]] == 0) {
+        last_instr->next = succ;
+        succ->prev = last_instr;
+        last_instr = succ;
+        last_instr->next = NULL;
       }
     }
   }
+  return entry->next;
+}
 
-  /* Schedule any instructions but stores */
-  for (j = 0; j < size_dg; j++) {
-    succ = matrix_dg[i * size_dg + j];
-    if (succ) {
-      if (succ->i_name != I_STORE) {
-        matrix_dg[i * size_dg + j] = NULL;
-        pred = NULL;
-        for (k = 0; k < size_dg; k++) {
-          pred = matrix_dg[k * size_dg + j];
-          if (pred)
-            break;
-        }
-        if (pred == NULL) {
-          last_instr->next = succ;
-          succ->prev = last_instr;
-          last_instr = succ;
-          last_instr->next = NULL;
-        }
-      }
-    }
-  }
+/**
+   \brief Schedule the block from istart: the ready successors of an
+   instruction are appended, then scheduled from depth first in the order
+   they were appended.  Each edge is visited once.
+ */
+void
+sched_block_breadth_first(INSTR_LIST *istart, int level)
+{
+  int top;
+  INSTR_LIST *instr, *first;
 
-  /* Schedule stores */
-  for (j = 0; j < size_dg; j++) {
-    succ = matrix_dg[i * size_dg + j];
-    if (succ) {
-      if (succ->i_name == I_STORE) {
-        matrix_dg[i * size_dg + j] = NULL;
-        pred = NULL;
-        for (k = 0; k < size_dg; k++) {
-          pred = matrix_dg[k * size_dg + j];
-          if (pred)
-            break;
-        }
-        if (pred == NULL) {
-          last_instr->next = succ;
-          succ->prev = last_instr;
-          last_instr = succ;
-          last_instr->next = NULL;
-        }
-      }
-    }
+  top = 0;
+  first = sched_succs(istart);
+  if (first) {
+    sched_first[top] = first;
+    sched_last[top++] = last_instr;
   }
-
-  succ = entry->next;
-  while (succ) {
-    sched_block_breadth_first(succ, level + 1);
-    succ = succ->next;
+  while (top > 0) {
+    instr = sched_first[top - 1];
+    if (instr == sched_last[top - 1])
+      top--;
+    else
+      sched_first[top - 1] = instr->next;
+    first = sched_succs(instr);
+    if (first) {
+      sched_first[top] = first;
+      sched_last[top++] = last_instr;
+    }
   }
 }
 
 void
 check_circular_dep(INSTR_LIST *istart)
 {
-  int i, j, k, l;
-  INSTR_LIST *succ, *ssucc;
+  int i, e;
 
   i = istart->rank - srank_dg;
   if (istart->flags & INST_VISITED) {
@@ -379,12 +496,9 @@ check_circular_dep(INSTR_LIST *istart)
     return;
   }
   istart->flags |= INST_VISITED;
-  for (j = 0; j < size_dg; j++) {
-    succ = matrix_dg[i * size_dg + j];
-    if (succ) {
-      printf("i%d -> ", istart->rank);
-      check_circular_dep(succ);
-    }
+  for (e = first_dg[i]; e < first_dg[i + 1]; e++) {
+    printf("i%d -> ", istart->rank);
+    check_circular_dep(instr_dg[succ_dg[e]]);
   }
   printf("\n");
   istart->flags &= ~INST_VISITED;
@@ -417,4 +531,5 @@ sched_instructions(INSTR_LIST *istart)
       sched_block(istart, instr);
     istart = instr;
   }
+  free_sched_graph();
 }
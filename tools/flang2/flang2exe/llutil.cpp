@@ -258,10 +258,15 @@ ll_add_func_proto(int sptr, unsigned flags, int nargs, DTYPE *args)
   int i;
   LL_Type *fty;
   const DTYPE dtype = DTYPEG(sptr);
-  LL_Type **fsig = (LL_Type **)malloc(sizeof(LL_Type *) * (nargs + 1));
-  LL_ABI_Info *abi = ll_abi_alloc(llvm_get_current_module(), nargs);
+  LL_Type **fsig;
+  LL_ABI_Info *abi;
 
   ll_proto_init();
+  /* ll_proto_add() keeps the first prototype registered for a name */
+  if (ll_proto_get_abi(SYMNAME(sptr)))
+    return;
+  fsig = (LL_Type **)malloc(sizeof(LL_Type *) * (nargs + 1));
+  abi = ll_abi_alloc(llvm_get_current_module(), nargs);
   abi->arg[0].type = fsig[0] = make_lltype_from_dtype(dtype);
   abi->arg[0].kind = LL_ARG_DIRECT;
   for (i = 0; i < nargs; ++i) {
@@ -1889,7 +1894,7 @@ void
 print_llsize(LL_Type *llt)
 {
   assert(llt, "print_llsize(): missing llt", 0, ERR_Fatal);
-  fprintf(LLVMFIL, "%" BIGIPFSZ "d", ll_type_bytes(llt) * 8);
+  ll_write_signed(LLVMFIL, ll_type_bytes(llt) * 8);
 }
 
 void
@@ -1909,7 +1914,7 @@ print_space(int num)
   int i;
 
   for (i = 0; i < num; i++)
-    fputc(' ', LLVMFIL);
+    ll_write_char(LLVMFIL, ' ');
 }
 
 void
@@ -1928,9 +1933,8 @@ void
 print_line(char *ln)
 {
   if (ln != NULL)
-    fprintf(LLVMFIL, "%s\n", ln);
-  else
-    fprintf(LLVMFIL, "\n");
+    ll_write_str(LLVMFIL, ln);
+  ll_write_char(LLVMFIL, '\n');
 }
 
 /**
@@ -1959,11 +1963,11 @@ print_token(const char *tk)
 {
   assert(tk, "print_token(): missing token", 0, ERR_Fatal);
   if (flg.omptarget && LLVMFIL == gbl.ompaccfile && !strncmp(tk,"@fort_ptr_assn",14)) {
-    fprintf(LLVMFIL, "@__tgt_");
-    fprintf(LLVMFIL, tk+1);
+    ll_write_str(LLVMFIL, "@__tgt_");
+    ll_write_str(LLVMFIL, tk+1);
   }
   else
-    fprintf(LLVMFIL, "%s", tk);
+    ll_write_str(LLVMFIL, tk);
 }
 
 /**
@@ -1982,7 +1986,7 @@ print_token_tobuf(char *tk, char *buf)
 void
 print_nl(void)
 {
-  fprintf(LLVMFIL, "\n");
+  ll_write_char(LLVMFIL, '\n');
 }
 
 void
@@ -1999,9 +2003,8 @@ print_nl_tobuf(char *buf)
 void
 print_dbg_line_no_comma(LL_MDRef md)
 {
-  char buf[32];
-  snprintf(buf, 32, " !dbg !%u", LL_MDREF_value(md));
-  print_token(buf);
+  ll_write_str(LLVMFIL, " !dbg !");
+  ll_write_unsigned(LLVMFIL, LL_MDREF_value(md));
 }
 
 void
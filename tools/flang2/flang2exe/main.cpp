@@ -41,14 +41,20 @@
 #include "rmsmove.h"
 #include "mwd.h"
 #include "llassem.h"
+#include "ll_write.h"
 #include "cgllvm.h"
 #include "outliner.h"
 #if !defined(TARGET_WIN)
 #include <unistd.h>
 #endif
 #include <time.h>
+#if !defined(TARGET_WIN)
+#include <sys/resource.h>
+#endif
 #include "ilm.h"
 #include "ili.h"
+#include "bih.h"
+#include "ilt.h"
 #include "upper.h"
 #include "semant.h"
 #include "dwarf2.h"
@@ -83,6 +89,7 @@ extern int HasRequiresUnifiedSharedMemory;
 /* contents of this file:  */
 
 static void reptime(void);
+static void repmem(const char *);
 static void init(int, char *[]);
 static void reinit(void);
 
@@ -141,8 +148,6 @@ static int ipa_import_mode = 0;
 #define NO_FLEXLM
 
 #if DEBUG
-#include "bih.h"
-#include "ilt.h"
 /** \brief Check line number, findex  after each various stages to make sure
  * they don't contain 0 as a line number, so that ccff_info don't get
  * linenumber as 0
@@ -317,6 +322,7 @@ process_input(char *argv0, bool *need_cuda_constructor)
 
         expand(); /* expand ILM's into ILI  */
         DUMP("expand");
+        repmem("expand");
 #if DEBUG
         check_lineno("expand");
 #endif
@@ -381,6 +387,7 @@ process_input(char *argv0, bool *need_cuda_constructor)
 #endif
         xtimes[5] += get_rutime();
         DUMP("schedule");
+        repmem("schedule");
       } /* CUDAG(GBL_CURRFUNC) & CUDA_HOST */
     }
     TR("F90 ASSEMBLER begins\n");
@@ -570,6 +577,38 @@ xbitcheck:
   fprintf(stderr, "%s\n", buf);
 }
 
+/** \brief Report table usage and peak memory after a phase of the current
+ * function, with the compilation statistics (-x 0 1).
+ *
+ * Dead ili are those no longer reachable from the ILT; the ili area is not
+ * compacted, so they stay allocated until the next function reuses them.
+ */
+static void
+repmem(const char *phase)
+{
+  int live;
+  long maxrss = 0;
+
+  if (!XBIT(0, 1))
+    return;
+  live = count_live_ili();
+#if !defined(TARGET_WIN)
+  {
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0)
+      maxrss = ru.ru_maxrss;
+  }
+#endif
+  fprintf(stderr, "  Memory after %s of %s:\n", phase, SYMNAME(gbl.currsub));
+  fprintf(stderr, "    ili %d used, %d live, %d allocated (%ld KB)\n",
+          ilib.stg_avail - 1, live, ilib.stg_size,
+          (long)(ilib.stg_size * sizeof(ILI) >> 10));
+  fprintf(stderr, "    ilt %d, bih %d, nme %d\n", iltb.stg_avail - 1,
+          bihb.stg_avail - 1, nmeb.stg_avail - 1);
+  if (maxrss)
+    fprintf(stderr, "    peak rss %ld KB\n", maxrss);
+}
+
 /** \brief Dump symbols
  *
  * Wrapper that takes no arguments
@@ -981,6 +1020,7 @@ do_curr_file:
     }
     if ((gbl.asmfil = fopen(asmfile, "w")) == NULL)
       errfatal((error_code_t)9);
+    ll_set_output_buffering(gbl.asmfil);
   } else /* do this for compilers which write asm code to stdout */
     gbl.asmfil = stdout;
 
@@ -1089,8 +1129,10 @@ finish()
     if (!flg.es)
       assemble_end();
   }
-  if (gbl.asmfil != NULL && gbl.asmfil != stdout)
+  if (gbl.asmfil != NULL && gbl.asmfil != stdout) {
+    ll_release_output_buffering(gbl.asmfil);
     fclose(gbl.asmfil);
+  }
 
   if (gbl.ilmfil != NULL)
     fclose(gbl.ilmfil);
@@ -1108,6 +1150,7 @@ finish()
   // AOCC Begin
   #ifdef OMP_OFFLOAD_LLVM
   if (gbl.ompaccfile != NULL && gbl.ompaccfile != stdout) {
+    ll_release_output_buffering(gbl.ompaccfile);
     fclose(gbl.ompaccfile);
     gbl.ompaccfile = NULL;
   }
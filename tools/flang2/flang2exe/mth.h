@@ -94,7 +94,16 @@ typedef enum MTH_FN {
   MTH_floor,
   MTH_ceil,
   MTH_aint,
-  MTH_cotan //AOCC 
+  MTH_cotan, //AOCC
+  MTH_erf,
+  MTH_erfc,
+  MTH_erfc_scaled,
+  MTH_gamma,
+  MTH_log_gamma,
+  MTH_bessel_j0,
+  MTH_bessel_j1,
+  MTH_bessel_y0,
+  MTH_bessel_y1
 } MTH_FN;
 
 #define MTH_I_DFIXK "__mth_i_dfixk"
@@ -136,6 +145,24 @@ typedef enum MTH_FN {
 #define MTH_I_DSINCOS "__mth_i_dsincos"
 #define MTH_I_DTAN "__mth_i_dtan"
 #define MTH_I_DCOTAN "__mth_i_dcotan" // AOCC
+#define MTH_I_ERF "__mth_i_erf"
+#define MTH_I_ERFC "__mth_i_erfc"
+#define MTH_I_ERFC_SCALED "__mth_i_erfc_scaled"
+#define MTH_I_GAMMA "__mth_i_gamma"
+#define MTH_I_LOG_GAMMA "__mth_i_log_gamma"
+#define MTH_I_BESSEL_J0 "__mth_i_bessel_j0"
+#define MTH_I_BESSEL_J1 "__mth_i_bessel_j1"
+#define MTH_I_BESSEL_Y0 "__mth_i_bessel_y0"
+#define MTH_I_BESSEL_Y1 "__mth_i_bessel_y1"
+#define MTH_I_DERF "__mth_i_derf"
+#define MTH_I_DERFC "__mth_i_derfc"
+#define MTH_I_DERFC_SCALED "__mth_i_derfc_scaled"
+#define MTH_I_DGAMMA "__mth_i_dgamma"
+#define MTH_I_DLOG_GAMMA "__mth_i_dlog_gamma"
+#define MTH_I_DBESSEL_J0 "__mth_i_dbessel_j0"
+#define MTH_I_DBESSEL_J1 "__mth_i_dbessel_j1"
+#define MTH_I_DBESSEL_Y0 "__mth_i_dbessel_y0"
+#define MTH_I_DBESSEL_Y1 "__mth_i_dbessel_y1"
 #define MTH_I_RPOWI "__mth_i_rpowi"
 #define MTH_I_RPOWK "__mth_i_rpowk"
 #define MTH_I_RPOWF "__mth_i_rpowr"
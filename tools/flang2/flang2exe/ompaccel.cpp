@@ -43,6 +43,7 @@
 #include "llmputil.h"
 #include "ccffinfo.h"
 #include "llutil.h"
+#include "ll_write.h"
 #include "ompaccel.h"
 #include "tgtutil.h"
 #include "dinit.h"
@@ -784,6 +785,7 @@ open_OMP_OFFLOAD_LLVM_file()
     fprintf(stderr, "Trying to open temp file %s\n", gbl.ompaccfilename);
 #endif
   }
+  ll_set_output_buffering(F);
   gbl.ompaccfile = F;
 }
 
@@ -45,8 +45,6 @@ static char buff[132];
 void
 sym_init_first(void)
 {
-  int i;
-
   int sizeof_SYM = sizeof(SYM) / sizeof(INT);
   assert(sizeof_SYM == 36, "bad SYM size", sizeof_SYM, ERR_Fatal);
 
@@ -71,9 +69,9 @@ sym_init_first(void)
 
   stb.namavl = 1;
   stb.wrdavl = 0;
-  for (i = 0; i <= HASHSIZE; i++)
-    stb.hashtb[i] = SPTR_NULL;
-
+  /* stb.hashtb is not cleared here: sym_init() copies init_hashtb over it
+   * for every function, so clearing it first would only double that cost.
+   */
 }
 
 /** \brief Expand symbol storage area when NEWSYM runs out of area.
@@ -77,13 +77,26 @@ extern "C" {
    somewhere.  This needs to be unified and cleaned.  */
 
 /* hashtab stuff */
-#define HASHSIZE 9973
-#define HASH_CON(p) ((p[0] ^ p[1]) % HASHSIZE)
-#define HASH_ID(hv, p, len)                            \
-  hv = p[(len)-1] | (*p << 16) | (p[(len) >> 1] << 8); \
-  if ((int)(len) > 3)                                  \
-    hv ^= (p[1] << 4);                                 \
-  hv %= HASHSIZE;
+#define HASHSIZE 65521
+/* Multiplicative mix of both constant words; the top half of the 64-bit
+ * product depends on every input bit. */
+#define HASH_CON(p)                                                      \
+  ((int)((((unsigned long long)((unsigned int)(p)[0] * 0x9E3779B1U ^    \
+                                (unsigned int)(p)[1]) *                  \
+          0x9E3779B97F4A7C15ULL) >>                                      \
+         32) %                                                           \
+         HASHSIZE))
+/* FNV-1a over the whole name, so generated names that differ only in
+ * their inner characters do not share a chain. */
+#define HASH_ID(hv, p, len)                                       \
+  do {                                                            \
+    const unsigned char *hash_p_ = (const unsigned char *)(p);    \
+    const unsigned char *hash_e_ = hash_p_ + (len);               \
+    unsigned int hash_h_ = 2166136261U;                           \
+    while (hash_p_ < hash_e_)                                     \
+      hash_h_ = (hash_h_ ^ *hash_p_++) * 16777619U;               \
+    hv = hash_h_ % HASHSIZE;                                      \
+  } while (0)
 #define HASH_STR(hv, p, len)     \
   if (len) {                     \
     /*hv =*/HASH_ID(hv, p, len); \
@@ -2375,6 +2375,7 @@ read_symbol(void)
     }
     INTENTINP(newsptr, intentin);
     ALLOCATTRP(newsptr, allocattr);
+    F90POINTERP(newsptr, f90pointer);
     LINENOP(newsptr, linenum);
     if (flg.debug && has_alias)
       save_modvar_alias(newsptr, alias_name);
@@ -3756,7 +3757,7 @@ fix_symbol(void)
           const int newMid = symbolxref[midnum];
           MIDNUMP(sptr, newMid);
 #ifdef REVMIDLNKP
-          if (POINTERG(sptr) && newMid) {
+          if ((POINTERG(sptr) || F90POINTERG(sptr)) && newMid) {
             assert(!REVMIDLNKG(newMid), "REVMIDLNK already set", newMid,
                    ERR_Fatal);
             REVMIDLNKP(newMid, sptr);
@@ -121,4 +121,40 @@ typedef enum omp_canceltype {
   CANCEL_TASKGROUP = 4,
 } omp_canceltype;
 
+/* Host tree reductions (-Mx,69,0x2000).  The front end passes one of these
+ * as the operator (stc) of each MP_REDUCTIONITEM ilm; the back end packs it
+ * with an MP_REDTY code into the reduce_data descriptor handed to
+ * __kmpc_reduce_nowait.  Keep in sync with _mp_reduce_kmpc() in
+ * runtime/flangrti/llcrit.c.
+ */
+typedef enum MP_REDOP {
+  MP_REDOP_NONE = 0,
+  MP_REDOP_ADD,
+  MP_REDOP_MUL,
+  MP_REDOP_MAX,
+  MP_REDOP_MIN,
+  MP_REDOP_IAND, /* also .and. on logicals */
+  MP_REDOP_IOR,  /* also .or. on logicals */
+  MP_REDOP_IEOR, /* also .neqv. on logicals */
+} MP_REDOP;
+
+typedef enum MP_REDTY {
+  MP_REDTY_NONE = 0,
+  MP_REDTY_I1,
+  MP_REDTY_I2,
+  MP_REDTY_I4,
+  MP_REDTY_I8,
+  MP_REDTY_R4,
+  MP_REDTY_R8,
+  MP_REDTY_C8,
+  MP_REDTY_C16,
+} MP_REDTY;
+
+/* reduce_data descriptor: word 0 is the item count, then three words per
+ * item: (MP_REDOP | MP_REDTY << 8), element count, address of the private
+ * copy.
+ */
+#define MP_RED_HDR 1
+#define MP_RED_ITEM 3
+
 #endif /* __MP_H__ */
@@ -120,6 +120,7 @@ FtnRteRtn ftnRtlRtns[] = {
     {"copy_f77_argsl", "", true, ""},
     {"copy_f90_argl", "", true, ""},
     {"copy_proc_desc", "", true, ""},
+    {"copy_stat", "", false, ""},
     {"dble", "", false, ""},
     {"dceiling", "", false, "k"},
     {"dceilingv", "", false, "k"},
@@ -236,6 +237,7 @@ FtnRteRtn ftnRtlRtns[] = {
     {"matmul_real8", "", true, ""},
     {"matmul_real8mxv_t", "", true, ""},
     {"matmul_real16mxv_t", "", true, ""},
+    {"matmul_team", "", true, ""},
     {"max", "", false, "k"},
     {"mcopy1", "", false, ""},
     {"mcopy2", "", false, ""},
@@ -125,6 +125,7 @@ typedef enum {
   RTE_copy_f77_argsl,
   RTE_copy_f90_argl,
   RTE_copy_proc_desc,
+  RTE_copy_stat,
   RTE_dble,
   RTE_dceiling,
   RTE_dceilingv,
@@ -241,6 +242,7 @@ typedef enum {
   RTE_matmul_real8,
   RTE_matmul_real8mxv_t,
   RTE_matmul_real16mxv_t,
+  RTE_matmul_team,
   RTE_max,
   RTE_mcopy1,
   RTE_mcopy2,